@@ -10,6 +10,8 @@
 
 typedef struct Type Type;
 typedef struct Member Member;
+typedef struct Function Function;
+typedef struct CallSite CallSite;
 
 //
 // tokenizer.c
@@ -37,12 +39,15 @@ struct Token {
     int cont_len;   // 文字列リテラルの長さ
 
     int line_no;    // Line number
+    int col_no;     // Column number
 };
 
 void error(char *fmt, ...);
 void error_at(char *loc, char *fmt, ...);
 void error_tok(Token *tok, char *fmt, ...);
 void warn_tok(Token *tok, char *fmt, ...);
+void info_tok(Token *tok, char *fmt, ...);
+void remark_tok(Token *tok, char *flag, char *pass, char *fmt, va_list ap);
 Token *peek(char *s);
 Token *consume(char *op);
 Token *consume_ident(void);
@@ -77,6 +82,8 @@ struct Var {
     // Global variable
     char *contents;
     int cont_len;
+
+    int mark;       // set membership in DCE, see new_mark()
 };
 
 // 変数のリストを表す構造体
@@ -100,6 +107,9 @@ typedef enum {
     ND_NE,        // !=  not equal
     ND_LT,        // <   less than
     ND_LE,        // <=  less equal
+    ND_LOGAND,    // &&
+    ND_LOGOR,     // ||
+    ND_NOT,       // !
     ND_ASSIGN,    // =  assign
     ND_COMMA,     // ,  comma
     ND_MEMBER,    // . (struct member access)
@@ -120,6 +130,7 @@ typedef enum {
 
 // 抽象構文木(AST)のノードの型
 typedef struct Node Node;
+typedef struct Vector Vector;
 struct Node {
     NodeKind kind; // ノードの型
     Node *next;    // next node
@@ -150,17 +161,70 @@ struct Node {
 
     Var *var;      // kind == ND_VAR
     long val;      // kind == ND_NUM
+
+    // Inlined function call
+    Function *inlined; // kind == ND_STMT_EXPR: the body is a copy of this function
+    Node *target;      // kind == ND_RETURN: the inlined call to return from
+    int end_seq;       // label at the end of an inlined call
+    int end_depth;     // stack depth at the start of an inlined call
+
+    // Vectorized loop
+    Vector *vec;       // kind == ND_FOR: run 16 bytes at a time first
+
+    int prof_id;       // first profile counter + 1, or 0 (see profile.c)
+
+    // Common subexpression elimination
+    int cse_size;      // nodes in the tree if it is pure, or 0
+    unsigned cse_hash; // equal for trees that same_expr() finds equal
+    bool cse_costly;   // the tree has a load, multiplication or division
+};
+
+// A loop that codegen runs with SSE2 before the scalar loop finishes
+// the last iterations. It is one of
+//
+//   dst[iv] = src1[iv] op src2[iv]
+//   dst[iv] = src1[iv] op scalar
+//   dst[iv] = src1[iv]
+//   sum = sum + src1[iv]
+struct Vector {
+    Node *iv;        // induction variable, stepped by 1
+    Node *limit;     // the loop runs while iv < limit
+    bool inclusive;  // ... or while iv <= limit
+    Type *ty;        // element type, char or int
+    NodeKind op;     // ND_ADD, ND_SUB, or ND_NULL for a copy
+    Node *dst;       // base of the stored array
+    Node *src1;      // base of a loaded array
+    Node *src2;
+    Node *scalar;    // loop-invariant operand
+    Node *sum;       // local that the elements are added to
+    bool check_src1; // dst may overlap src1 at run time
+    bool check_src2;
 };
 
-typedef struct Function Function;
 struct Function {
     Function *next;  // 次の関数
     char *name;      // 関数名
+    Token *tok;
     VarList *params; // 関数の引数の連結リストの先頭アドレス
 
     Node *node;      // 関数内のNode
     VarList *locals; // (関数内のローカル変数+関数の引数)の連結リストの先頭のアドレス
     int stack_size;  // スタックサイズ
+
+    bool is_static;  // "static": not visible outside of the file
+    bool is_inline;  // "inline": a hint to inline calls to the function
+
+    // Stack usage found by codegen, in bytes below the caller's rsp
+    int frame_bytes; // return address, saved rbp, locals and padding
+    int push_bytes;  // deepest expression stack
+    CallSite *calls;
+};
+
+// A call made by a function and the stack in use at the call
+struct CallSite {
+    CallSite *next;
+    char *name;
+    int stack_bytes;
 };
 
 // トップレベルのitemについての型
@@ -229,8 +293,164 @@ void add_type(Node *node);
 
 void codegen(Program *prog);
 
+//
+// pass.c
+//
+
+extern int opt_bisect_limit;
+void run_passes(Program *prog);
+bool should_run_pass(char *pass, Function *fn);
+void set_remark_filter(bool missed, char *pattern);
+void remark(char *pass, Token *tok, char *fmt, ...);
+void remark_missed(char *pass, Token *tok, char *fmt, ...);
+
+//
+// stack.c
+//
+
+void report_stack_usage(Program *prog, char *input_path);
+
+//
+// opt.c
+//
+
+bool is_pure(Node *node);
+bool same_expr(Node *a, Node *b);
+void inline_functions(Program *prog);
+void unroll_loops(Program *prog);
+void move_loop_invariants(Program *prog);
+void vectorize_loops(Program *prog);
+void eliminate_common_subexprs(Program *prog);
+void print_cse_stats(void);
+void eliminate_dead_code(Program *prog);
+
+//
+// profile.c
+//
+
+extern int profile_size;
+extern unsigned profile_checksum;
+void number_profile_points(Program *prog);
+void read_profile(Program *prog, char *path);
+long profile_count(Node *node, int k);
+bool is_hot_call(Node *node);
+bool is_cold(long count, long total);
+
+//
+// alloc.c
+//
+
+typedef enum {
+    MEM_INPUT,
+    MEM_TOKEN,
+    MEM_NODE,
+    MEM_TYPE,
+    MEM_VAR,
+    MEM_SCOPE,
+    MEM_STRING,
+    MEM_OPT,
+    MEM_OUTPUT,
+    MEM_OTHER,
+    NUM_MEMKINDS,
+} MemKind;
+
+extern long mem_allocated;
+void mem_account(MemKind kind, size_t size);
+void mem_release(MemKind kind, size_t size);
+void *alloc(MemKind kind, size_t size);
+char *alloc_strndup(MemKind kind, char *s, size_t n);
+void print_mem_report(void);
+
+//
+// timevar.c
+//
+
+typedef enum {
+    TV_READ,
+    TV_LEX,
+    TV_PARSE,
+    TV_TYPE,
+    TV_PROFILE,
+    TV_INLINE,
+    TV_VECTORIZE,
+    TV_UNROLL,
+    TV_LICM,
+    TV_CSE,
+    TV_DCE,
+    TV_FRAME,
+    TV_CODEGEN,
+    TV_EMIT,
+    TV_ASSEMBLE,
+    NUM_TIMEVARS,
+} TimeVar;
+
+// Counters reported by -ftime-report
+typedef struct {
+    long input_bytes;
+    long tokens;
+    long nodes;            // AST nodes created by the parser
+    long type_visits;      // calls of add_type
+    long lookups;          // variable lookups
+    long lookup_steps;     // scopes walked by the lookups
+    long max_lookup_chain;
+    long asm_insns;
+    long asm_bytes;        // of assembly, or of the object with -c
+} Stats;
+
+extern Stats stats;
+void timevar_push(TimeVar tv);
+void timevar_pop(TimeVar tv);
+void print_time_report(void);
+void print_phase_memory(void);
+
+//
+// emit.c
+//
+
+void println(char *fmt, ...);
+void emit_dry_run(bool on);
+void emit_flush(void);
+void print_peephole_stats(void);
+
+//
+// asm.c
+//
+
+void asm_insn(char *op, char *dst, char *src);
+void asm_label(char *name);
+void asm_directive(char *line);
+void write_object(FILE *out);
+
 //
 // main.c
 //
 
 extern FILE *output_file;
+extern bool opt_peephole;
+extern bool opt_sort_globals;
+extern bool opt_omit_frame_pointer;
+extern bool opt_inline;
+extern int opt_inline_limit;
+extern bool opt_info_inline;
+extern bool opt_optimize_sibling_calls;
+extern bool opt_peel_loops;
+extern bool opt_unroll_loops;
+extern int opt_unroll_factor;
+extern bool opt_align_loops;
+extern bool opt_move_loop_invariants;
+extern bool opt_ivopts;
+extern bool opt_cse;
+extern bool opt_tree_vectorize;
+extern bool opt_profile_generate;
+extern bool opt_profile_use;
+extern char *opt_profile_path;
+extern bool opt_instrument_cycles;
+extern bool opt_time_report;
+extern bool opt_time_report_json;
+extern bool opt_mem_report;
+extern bool opt_stack_usage;
+extern char *opt_stack_usage_path;
+extern int opt_frame_larger_than;
+extern char *opt_cycles_path;
+extern bool opt_dce;
+extern bool opt_emit_object;
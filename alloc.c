@@ -0,0 +1,94 @@
+#include "9cc.h"
+
+// Memory accounting for -fmem-report
+//
+// Every long-lived object is allocated with alloc() under a category so
+// that the report can tell what the memory of a compilation is made of.
+// Nearly nothing is freed; only the instructions of the output buffer
+// are released after each function, so that category also tracks its
+// live size.
+
+typedef struct {
+    char *name;
+    long count;
+    long bytes;
+    long live;
+    long peak;
+} MemStat;
+
+static MemStat mem[] = {
+    [MEM_INPUT] = {"input"},
+    [MEM_TOKEN] = {"tokens"},
+    [MEM_NODE] = {"AST nodes"},
+    [MEM_TYPE] = {"types"},
+    [MEM_VAR] = {"variables"},
+    [MEM_SCOPE] = {"scopes"},
+    [MEM_STRING] = {"strings"},
+    [MEM_OPT] = {"optimizer"},
+    [MEM_OUTPUT] = {"output buffer"},
+    [MEM_OTHER] = {"other"},
+};
+
+// Allocation sizes by power of two: <=8, <=16, ..., <=4096, larger
+#define NUM_BUCKETS 11
+static long histogram[NUM_BUCKETS];
+
+long mem_allocated;
+
+void mem_account(MemKind kind, size_t size) {
+    MemStat *m = &mem[kind];
+    m->count++;
+    m->bytes += size;
+    m->live += size;
+    if(m->peak < m->live)
+        m->peak = m->live;
+    mem_allocated += size;
+
+    int b = 0;
+    while(b < NUM_BUCKETS - 1 && (8L << b) < size)
+        b++;
+    histogram[b]++;
+}
+
+void mem_release(MemKind kind, size_t size) {
+    mem[kind].live -= size;
+}
+
+void *alloc(MemKind kind, size_t size) {
+    void *p = calloc(1, size);
+    if(!p)
+        error("out of memory");
+    mem_account(kind, size);
+    return p;
+}
+
+char *alloc_strndup(MemKind kind, char *s, size_t n) {
+    char *p = strndup(s, n);
+    if(!p)
+        error("out of memory");
+    mem_account(kind, strlen(p) + 1);
+    return p;
+}
+
+void print_mem_report(void) {
+    long count = 0, bytes = 0;
+    fprintf(stderr, "Memory allocated\n");
+    fprintf(stderr, "  %-14s %10s %12s %12s\n", "category", "count", "bytes", "peak live");
+    for(int i = 0; i < NUM_MEMKINDS; i++) {
+        MemStat *m = &mem[i];
+        fprintf(stderr, "  %-14s %10ld %12ld %12ld\n", m->name, m->count, m->bytes, m->peak);
+        count += m->count;
+        bytes += m->bytes;
+    }
+    fprintf(stderr, "  %-14s %10ld %12ld\n", "TOTAL", count, bytes);
+
+    fprintf(stderr, "Allocation sizes\n");
+    for(int b = 0; b < NUM_BUCKETS; b++) {
+        if(b < NUM_BUCKETS - 1)
+            fprintf(stderr, "  <= %-9ld %10ld\n", 8L << b, histogram[b]);
+        else
+            fprintf(stderr, "  >  %-9ld %10ld\n", 8L << (b - 1), histogram[b]);
+    }
+
+    print_phase_memory();
+}
@@ -0,0 +1,2240 @@
+#include "9cc.h"
+#include <elf.h>
+#include <limits.h>
+#include <unistd.h>
+
+// Integrated assembler for -c
+//
+// The lines that emit.c would otherwise print are encoded here, and
+// write_object() writes the result as an ELF relocatable object. Only
+// what codegen produces is understood: its instructions in Intel syntax
+// and the directives for sections, symbols, data, CFI and line numbers.
+//
+// Encodings, relocations and the generated .eh_frame and .debug_line
+// are the ones GNU as produces for the same text, so that an object
+// from -c can be compared with the assembled output of a compile
+// without it (see tests/asm-check.sh). As in as, the contents of a
+// section are a list of fragments: fixed bytes followed by a jump whose
+// size is not known yet or by alignment padding. Jumps start out short
+// and are made long until every displacement fits.
+
+typedef struct Section Section;
+typedef struct Symbol Symbol;
+
+typedef struct {
+    unsigned char *data;
+    long len;
+    long cap;
+} Buf;
+
+static void buf_add(Buf *buf, void *p, long n) {
+    if(buf->len + n > buf->cap) {
+        long cap = buf->cap ? buf->cap : 256;
+        while(cap < buf->len + n)
+            cap *= 2;
+        buf->data = realloc(buf->data, cap);
+        mem_account(MEM_OUTPUT, cap - buf->cap);
+        buf->cap = cap;
+    }
+    memcpy(buf->data + buf->len, p, n);
+    buf->len += n;
+}
+
+// Stores the `size` low bytes of `val` at `p`, least significant first.
+static void put_int(unsigned char *p, long val, int size) {
+    for(int i = 0; i < size; i++)
+        p[i] = val >> (i * 8);
+}
+
+typedef enum {
+    FR_FIXED, // nothing after the fixed part
+    FR_JUMP,  // jmp or jcc to a symbol
+    FR_ALIGN, // padding to a power of two
+} FragKind;
+
+typedef struct Frag Frag;
+struct Frag {
+    Frag *next;
+    Buf buf;        // the fixed part; empty in a NOBITS section
+    long size;      // bytes in the fixed part
+    long addr;      // offset in the section
+    FragKind kind;
+
+    // FR_JUMP
+    int cond;       // condition code, or -1 for jmp
+    Symbol *target;
+    bool is_long;
+
+    // FR_ALIGN
+    int align;
+    int max_skip;   // or -1
+    int pad;
+};
+
+// A location in a section
+typedef struct {
+    Frag *frag;
+    long off;
+} Pos;
+
+struct Symbol {
+    Symbol *next;      // in order of creation
+    Symbol *hash_next;
+    char *name;
+    Section *sec;      // NULL while undefined
+    Pos pos;
+    Symbol *alias;     // .set sym, alias+offset
+    long offset;
+    bool global;
+    bool is_section;
+    bool used;         // by a relocation
+    int type;          // STT_*
+    long size;
+    Pos end;           // .size sym, .-sym
+    bool has_end;
+    int index;         // in .symtab
+};
+
+typedef struct Fixup Fixup;
+struct Fixup {
+    Fixup *next;
+    Pos pos;
+    int size;
+    int type;          // R_X86_64_*
+    Symbol *sym;
+    long addend;
+};
+
+typedef struct Reloc Reloc;
+struct Reloc {
+    Reloc *next;
+    long offset;
+    int type;
+    Symbol *sym;
+    long addend;
+};
+
+struct Section {
+    Section *next;
+    char *name;
+    int type;          // SHT_*
+    long flags;        // SHF_*
+    int entsize;
+    int align;
+    Frag *frags;
+    Frag *last;
+    Fixup *fixups;
+    Fixup *last_fixup;
+    Symbol *sym;       // the section symbol
+
+    // Filled in by write_object()
+    long size;
+    Buf data;
+    Reloc *relocs;
+    Reloc *last_reloc;
+    int nrelocs;
+    int index;
+    int rela_index;
+    long offset;
+    long rela_offset;
+};
+
+static Section *sections;
+static Section *last_section;
+static Section *cur;
+
+static Symbol *symbols;
+static Symbol *last_symbol;
+#define SYMTAB_SIZE 4096
+static Symbol *symtab[SYMTAB_SIZE];
+
+//
+// Sections and fragments
+//
+
+static Frag *new_frag(Section *sec) {
+    Frag *frag = alloc(MEM_OUTPUT, sizeof(Frag));
+    if(sec->last)
+        sec->last->next = frag;
+    else
+        sec->frags = frag;
+    sec->last = frag;
+    return frag;
+}
+
+static Section *new_section(char *name, int type, long flags) {
+    Section *sec = alloc(MEM_OUTPUT, sizeof(Section));
+    sec->name = name;
+    sec->type = type;
+    sec->flags = flags;
+    sec->align = 1;
+    new_frag(sec);
+    if(last_section)
+        last_section->next = sec;
+    else
+        sections = sec;
+    last_section = sec;
+    return sec;
+}
+
+static Section *find_section(char *name) {
+    for(Section *sec = sections; sec; sec = sec->next)
+        if(!strcmp(sec->name, name))
+            return sec;
+    return NULL;
+}
+
+// As starts out in .text with .data and .bss already made.
+static void init(void) {
+    if(sections)
+        return;
+    cur = new_section(".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR);
+    new_section(".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE);
+    new_section(".bss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE);
+}
+
+static Pos here(void) {
+    return (Pos){cur->last, cur->last->size};
+}
+
+static long pos_addr(Pos pos) {
+    return pos.frag->addr + pos.off;
+}
+
+static void out_bytes(void *p, long n) {
+    Frag *frag = cur->last;
+    if(cur->type == SHT_NOBITS)
+        error("-c: data in NOBITS section %s", cur->name);
+    buf_add(&frag->buf, p, n);
+    frag->size += n;
+}
+
+static void out(int c) {
+    unsigned char b = c;
+    out_bytes(&b, 1);
+}
+
+static void out_int(long val, int size) {
+    unsigned char buf[8];
+    put_int(buf, val, size);
+    out_bytes(buf, size);
+}
+
+static void out_uleb(unsigned long val) {
+    do {
+        int c = val & 0x7f;
+        val >>= 7;
+        out(val ? c | 0x80 : c);
+    } while(val);
+}
+
+static void out_sleb(long val) {
+    for(;;) {
+        int c = val & 0x7f;
+        val >>= 7;
+        if((val == 0 && !(c & 0x40)) || (val == -1 && (c & 0x40))) {
+            out(c);
+            return;
+        }
+        out(c | 0x80);
+    }
+}
+
+static void out_str(char *s) {
+    out_bytes(s, strlen(s) + 1);
+}
+
+// Emits a `size`-byte field that the symbol is added to later.
+static void out_fixup(int type, Symbol *sym, long addend, int size) {
+    Fixup *fix = alloc(MEM_OUTPUT, sizeof(Fixup));
+    fix->pos = here();
+    fix->size = size;
+    fix->type = type;
+    fix->sym = sym;
+    fix->addend = addend;
+    if(cur->last_fixup)
+        cur->last_fixup->next = fix;
+    else
+        cur->fixups = fix;
+    cur->last_fixup = fix;
+    out_int(0, size);
+}
+
+// Ends the current fragment with a variable part of kind `kind`.
+static Frag *end_frag(FragKind kind) {
+    Frag *frag = cur->last;
+    frag->kind = kind;
+    new_frag(cur);
+    return frag;
+}
+
+static void align_frag(int align, int max_skip) {
+    Frag *frag = end_frag(FR_ALIGN);
+    frag->align = align;
+    frag->max_skip = max_skip;
+    if(cur->align < align)
+        cur->align = align;
+}
+
+//
+// Symbols
+//
+
+static unsigned hash(char *s) {
+    unsigned h = 2166136261u;
+    for(; *s; s++)
+        h = (h ^ (unsigned char)*s) * 16777619u;
+    return h;
+}
+
+static Symbol *intern(char *name) {
+    unsigned h = hash(name) % SYMTAB_SIZE;
+    for(Symbol *sym = symtab[h]; sym; sym = sym->hash_next)
+        if(!strcmp(sym->name, name))
+            return sym;
+
+    Symbol *sym = alloc(MEM_OUTPUT, sizeof(Symbol));
+    sym->name = alloc_strndup(MEM_OUTPUT, name, strlen(name));
+    sym->hash_next = symtab[h];
+    symtab[h] = sym;
+    if(last_symbol)
+        last_symbol->next = sym;
+    else
+        symbols = sym;
+    last_symbol = sym;
+    return sym;
+}
+
+static Symbol *section_symbol(Section *sec) {
+    if(!sec->sym) {
+        Symbol *sym = alloc(MEM_OUTPUT, sizeof(Symbol));
+        sym->name = sec->name;
+        sym->sec = sec;
+        sym->pos = (Pos){sec->frags, 0};
+        sym->is_section = true;
+        sym->type = STT_SECTION;
+        sec->sym = sym;
+    }
+    return sec->sym;
+}
+
+static Section *sym_section(Symbol *sym) {
+    return sym->alias ? sym_section(sym->alias) : sym->sec;
+}
+
+static long sym_value(Symbol *sym) {
+    if(sym->alias)
+        return sym_value(sym->alias) + sym->offset;
+    return sym->sec ? pos_addr(sym->pos) : 0;
+}
+
+static bool is_local_label(Symbol *sym) {
+    return !strncmp(sym->name, ".L", 2);
+}
+
+void asm_label(char *name) {
+    init();
+    Symbol *sym = intern(name);
+    if(sym->sec || sym->alias)
+        error("-c: symbol %s is already defined", name);
+    sym->sec = cur;
+    sym->pos = here();
+}
+
+//
+// Operands
+//
+
+#define NO_REG -1
+#define RIP -2
+
+typedef enum {
+    OPD_NONE,
+    OPD_REG,
+    OPD_XMM,
+    OPD_MEM,
+    OPD_IMM,
+    OPD_SYM, // a bare symbol, the target of a jump or call
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    int size;    // in bytes, or 0 for memory without a size
+    int reg;     // OPD_REG and OPD_XMM
+    int base;    // OPD_MEM: a register, RIP or NO_REG
+    int index;
+    int scale;
+    long val;    // displacement or immediate
+    Symbol *sym; // added to `val`
+} Operand;
+
+// Registers in the order of their encoding
+static char *reg_names[4][16] = {
+    {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+     "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"},
+    {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+     "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"},
+    {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+     "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"},
+    {"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+     "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"},
+};
+
+static int reg_sizes[] = {8, 4, 2, 1};
+
+// Returns the number of a general purpose register and sets its size.
+static int parse_reg(char *name, int *size) {
+    for(int i = 0; i < 4; i++) {
+        for(int j = 0; j < 16; j++) {
+            if(!strcmp(name, reg_names[i][j])) {
+                *size = reg_sizes[i];
+                return j;
+            }
+        }
+    }
+    return NO_REG;
+}
+
+static int parse_xmm(char *name) {
+    if(strncmp(name, "xmm", 3) || !isdigit(name[3]))
+        return NO_REG;
+    char *end;
+    long n = strtol(name + 3, &end, 10);
+    return (*end || n > 15) ? NO_REG : n;
+}
+
+static bool is_number(char *s) {
+    return isdigit(*s) || (*s == '-' && isdigit(s[1]));
+}
+
+// Adds a term of an address or immediate, e.g. "rbp", "rax*4", "-8"
+// or ".L.data.3", to `opd`.
+static void add_term(Operand *opd, char *term, int sign) {
+    char *star = strchr(term, '*');
+    if(star) {
+        *star = '\0';
+        int size;
+        opd->index = parse_reg(term, &size);
+        opd->scale = atoi(star + 1);
+        if(opd->index == NO_REG || sign < 0)
+            error("-c: bad index: %s", term);
+        return;
+    }
+
+    if(is_number(term)) {
+        opd->val += sign * strtol(term, NULL, 0);
+        return;
+    }
+
+    int size;
+    int reg = parse_reg(term, &size);
+    if(!strcmp(term, "rip"))
+        reg = RIP;
+    if(reg != NO_REG) {
+        if(opd->base == NO_REG) {
+            opd->base = reg;
+        } else {
+            opd->index = reg;
+            opd->scale = 1;
+        }
+        return;
+    }
+
+    if(opd->sym || sign < 0)
+        error("-c: bad expression: %s", term);
+    opd->sym = intern(term);
+}
+
+// Parses "a+b-c" into `opd`.
+static void parse_expr(Operand *opd, char *s) {
+    int sign = 1;
+    for(;;) {
+        while(*s == ' ')
+            s++;
+        if(*s == '-') {
+            sign = -sign;
+            s++;
+            continue;
+        }
+        char *q = s;
+        while(*q && *q != '+' && *q != '-')
+            q++;
+        char *end = q;
+        while(end > s && end[-1] == ' ')
+            end--;
+        char *term = strndup(s, end - s);
+        if(*term)
+            add_term(opd, term, sign);
+        free(term);
+        if(!*q)
+            return;
+        sign = (*q == '-') ? -1 : 1;
+        s = q + 1;
+    }
+}
+
+static Operand parse_operand(char *s) {
+    Operand opd = {.base = NO_REG, .index = NO_REG};
+    if(!s)
+        return opd;
+
+    static struct {
+        char *prefix;
+        int size;
+    } ptrs[] = {
+        {"byte ptr ", 1}, {"word ptr ", 2}, {"dword ptr ", 4},
+        {"qword ptr ", 8}, {"xmmword ptr ", 16},
+    };
+    for(int i = 0; i < sizeof(ptrs) / sizeof(*ptrs); i++) {
+        int len = strlen(ptrs[i].prefix);
+        if(!strncmp(s, ptrs[i].prefix, len)) {
+            opd.size = ptrs[i].size;
+            s += len;
+            break;
+        }
+    }
+
+    if(*s == '[') {
+        char *end = strchr(s, ']');
+        if(!end)
+            error("-c: bad operand: %s", s);
+        char *inner = strndup(s + 1, end - s - 1);
+        opd.kind = OPD_MEM;
+        parse_expr(&opd, inner);
+        free(inner);
+        return opd;
+    }
+
+    if(!strncmp(s, "offset ", 7)) {
+        opd.kind = OPD_IMM;
+        parse_expr(&opd, s + 7);
+        return opd;
+    }
+
+    if(is_number(s)) {
+        opd.kind = OPD_IMM;
+        opd.val = strtol(s, NULL, 0);
+        return opd;
+    }
+
+    opd.reg = parse_reg(s, &opd.size);
+    if(opd.reg != NO_REG) {
+        opd.kind = OPD_REG;
+        return opd;
+    }
+
+    opd.reg = parse_xmm(s);
+    if(opd.reg != NO_REG) {
+        opd.kind = OPD_XMM;
+        opd.size = 16;
+        return opd;
+    }
+
+    opd.kind = OPD_SYM;
+    opd.sym = intern(s);
+    return opd;
+}
+
+//
+// Instruction encoding
+//
+
+static char *cur_op;
+
+static void bad_operands(void) {
+    error("-c: unsupported operands for %s", cur_op);
+}
+
+static bool fits8(long val) {
+    return val >= -128 && val <= 127;
+}
+
+static bool fits32(long val) {
+    return val >= INT_MIN && val <= INT_MAX;
+}
+
+// Emits opcode bytes, most significant first: 0x0faee8 is 0f ae e8.
+static void out_opcode(long opcode) {
+    if(opcode > 0xffff)
+        out(opcode >> 16);
+    if(opcode > 0xff)
+        out(opcode >> 8);
+    out(opcode);
+}
+
+// spl, bpl, sil and dil can only be encoded with a REX prefix.
+static bool needs_rex(Operand *opd) {
+    return opd->kind == OPD_REG && opd->size == 1 && opd->reg >= 4 && opd->reg < 8;
+}
+
+// Emits the ModRM byte for register or opcode extension `r` and the
+// operand `rm`, and the SIB byte and displacement that go with it.
+// `imm_size` is the size of the immediate that follows, which a
+// rip-relative displacement has to account for.
+static void out_modrm(int r, Operand *rm, int imm_size) {
+    r &= 7;
+    if(rm->kind != OPD_MEM) {
+        out(0xc0 | r << 3 | (rm->reg & 7));
+        return;
+    }
+
+    if(rm->base == RIP) {
+        out(r << 3 | 5);
+        if(rm->sym)
+            out_fixup(R_X86_64_PC32, rm->sym, rm->val - 4 - imm_size, 4);
+        else
+            out_int(rm->val, 4);
+        return;
+    }
+
+    int ss = 0;
+    while(ss < 3 && (1 << ss) < rm->scale)
+        ss++;
+    int index = (rm->index == NO_REG) ? 4 : rm->index & 7;
+
+    int mod;
+    if(rm->base == NO_REG) {
+        out(r << 3 | 4);
+        out(ss << 6 | index << 3 | 5);
+        mod = 2;
+    } else {
+        int base = rm->base & 7;
+        if(rm->sym || !fits8(rm->val))
+            mod = 2;
+        else if(rm->val == 0 && base != 5)
+            mod = 0;
+        else
+            mod = 1;
+
+        if(rm->index != NO_REG || base == 4) {
+            out(mod << 6 | r << 3 | 4);
+            out(ss << 6 | index << 3 | base);
+        } else {
+            out(mod << 6 | r << 3 | base);
+        }
+    }
+
+    if(mod == 1)
+        out(rm->val);
+    else if(mod == 2 && rm->sym)
+        out_fixup(R_X86_64_32S, rm->sym, rm->val, 4);
+    else if(mod == 2)
+        out_int(rm->val, 4);
+}
+
+// Emits `prefix` (0x66 or 0xf3, or 0 for none), a REX prefix if needed,
+// `opcode` and the ModRM byte for `r` and `rm`. `r_byte` tells that `r`
+// is a byte register.
+static void out_insn(int prefix, bool rex_w, long opcode, int r, bool r_byte,
+                     Operand *rm, int imm_size) {
+    if(prefix)
+        out(prefix);
+
+    int rex = rex_w ? 8 : 0;
+    if(r >= 8)
+        rex |= 4;
+    if(rm->kind == OPD_MEM) {
+        if(rm->index >= 8)
+            rex |= 2;
+        if(rm->base >= 8)
+            rex |= 1;
+    } else if(rm->reg >= 8) {
+        rex |= 1;
+    }
+    if(rex || (r_byte && r >= 4 && r < 8) || needs_rex(rm))
+        out(0x40 | rex);
+
+    out_opcode(opcode);
+    out_modrm(r, rm, imm_size);
+}
+
+// Emits an instruction without ModRM byte whose opcode may have a
+// register in its low three bits.
+static void out_short(int prefix, bool rex_w, long opcode, int reg) {
+    if(prefix)
+        out(prefix);
+    if(rex_w || reg >= 8)
+        out(0x40 | (rex_w ? 8 : 0) | (reg >= 8));
+    out_opcode(opcode | (reg & 7));
+}
+
+static int imm_size(int size) {
+    return (size == 8) ? 4 : size;
+}
+
+static void out_imm(Operand *imm, int size, int reloc) {
+    if(imm->sym) {
+        out_fixup(reloc, imm->sym, imm->val, size);
+        return;
+    }
+    // Like as, take values that fit signed or unsigned, but unlike as
+    // do not shorten the others.
+    long val = imm->val;
+    if(size < 8 && val >> (size * 8 - 1) != 0 && val >> (size * 8 - 1) != -1 &&
+       val >> (size * 8) != 0)
+        error("-c: immediate out of range for %s: %ld", cur_op, val);
+    out_int(imm->val, size);
+}
+
+// Returns the operand size of an instruction with operands `a` and `b`.
+static int op_size(Operand *a, Operand *b) {
+    if(a->kind == OPD_REG || a->kind == OPD_XMM)
+        return a->size;
+    if(b->kind == OPD_REG || b->kind == OPD_XMM)
+        return b->size;
+    if(!a->size)
+        error("-c: operand size unknown for %s", cur_op);
+    return a->size;
+}
+
+static int size_prefix(int size) {
+    return (size == 2) ? 0x66 : 0;
+}
+
+// add, or, adc, sbb, and, sub, xor and cmp: opcode group `n`
+static void enc_alu(int n, Operand *a, Operand *b, Operand *c) {
+    int size = op_size(a, b);
+    int pre = size_prefix(size);
+    bool w = size == 8;
+
+    if(b->kind == OPD_IMM) {
+        if(size != 1 && !b->sym && fits8(b->val)) {
+            out_insn(pre, w, 0x83, n, false, a, 1);
+            out(b->val);
+        } else if(a->kind == OPD_REG && a->reg == 0) {
+            out_short(pre, w, n << 3 | (size == 1 ? 4 : 5), 0);
+            out_imm(b, imm_size(size), size == 8 ? R_X86_64_32S : R_X86_64_32);
+        } else {
+            out_insn(pre, w, size == 1 ? 0x80 : 0x81, n, false, a, imm_size(size));
+            out_imm(b, imm_size(size), size == 8 ? R_X86_64_32S : R_X86_64_32);
+        }
+        return;
+    }
+
+    if(b->kind == OPD_REG && (a->kind == OPD_REG || a->kind == OPD_MEM))
+        out_insn(pre, w, n << 3 | (size == 1 ? 0 : 1), b->reg, size == 1, a, 0);
+    else if(a->kind == OPD_REG && b->kind == OPD_MEM)
+        out_insn(pre, w, n << 3 | (size == 1 ? 2 : 3), a->reg, size == 1, b, 0);
+    else
+        bad_operands();
+}
+
+static void enc_mov(int arg, Operand *a, Operand *b, Operand *c) {
+    int size = op_size(a, b);
+    int pre = size_prefix(size);
+    bool w = size == 8;
+
+    if(a->kind == OPD_REG && b->kind == OPD_IMM) {
+        if(size == 8 && (b->sym || fits32(b->val))) {
+            out_insn(0, true, 0xc7, 0, false, a, 4);
+            out_imm(b, 4, R_X86_64_32S);
+        } else if(size == 8) {
+            out_short(0, true, 0xb8, a->reg);
+            out_int(b->val, 8);
+        } else {
+            if(needs_rex(a))
+                out(0x40);
+            out_short(pre, false, size == 1 ? 0xb0 : 0xb8, a->reg);
+            out_imm(b, size, R_X86_64_32);
+        }
+        return;
+    }
+
+    if(a->kind == OPD_MEM && b->kind == OPD_IMM) {
+        out_insn(pre, w, size == 1 ? 0xc6 : 0xc7, 0, false, a, imm_size(size));
+        out_imm(b, imm_size(size), size == 8 ? R_X86_64_32S : R_X86_64_32);
+        return;
+    }
+
+    if(b->kind == OPD_REG && (a->kind == OPD_REG || a->kind == OPD_MEM))
+        out_insn(pre, w, size == 1 ? 0x88 : 0x89, b->reg, size == 1, a, 0);
+    else if(a->kind == OPD_REG && b->kind == OPD_MEM)
+        out_insn(pre, w, size == 1 ? 0x8a : 0x8b, a->reg, size == 1, b, 0);
+    else
+        bad_operands();
+}
+
+static void enc_push(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind == OPD_REG) {
+        out_short(0, false, 0x50, a->reg);
+    } else if(a->kind == OPD_IMM && !a->sym && fits8(a->val)) {
+        out(0x6a);
+        out(a->val);
+    } else if(a->kind == OPD_IMM) {
+        out(0x68);
+        out_imm(a, 4, R_X86_64_32S);
+    } else if(a->kind == OPD_MEM) {
+        out_insn(0, false, 0xff, 6, false, a, 0);
+    } else {
+        bad_operands();
+    }
+}
+
+static void enc_pop(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind == OPD_REG)
+        out_short(0, false, 0x58, a->reg);
+    else if(a->kind == OPD_MEM)
+        out_insn(0, false, 0x8f, 0, false, a, 0);
+    else
+        bad_operands();
+}
+
+static void enc_lea(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_REG || b->kind != OPD_MEM)
+        bad_operands();
+    out_insn(size_prefix(a->size), a->size == 8, 0x8d, a->reg, false, b, 0);
+}
+
+static void enc_movsxd(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_REG || (b->kind != OPD_REG && b->kind != OPD_MEM))
+        bad_operands();
+    out_insn(0, a->size == 8, 0x63, a->reg, false, b, 0);
+}
+
+// movsx and movzx: `opcode` is the byte form, plus one for words.
+static void enc_movx(int opcode, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_REG || (b->kind != OPD_REG && b->kind != OPD_MEM))
+        bad_operands();
+    int from = b->size ? b->size : 1;
+    if(from != 1 && from != 2)
+        bad_operands();
+    out_insn(size_prefix(a->size), a->size == 8, opcode + (from == 2), a->reg, false, b, 0);
+}
+
+// movzb is movzx from a byte.
+static void enc_movzb(int arg, Operand *a, Operand *b, Operand *c) {
+    if(b->kind == OPD_MEM && !b->size)
+        b->size = 1;
+    if(b->size != 1)
+        bad_operands();
+    enc_movx(0x0fb6, a, b, c);
+}
+
+static void enc_imul(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_REG)
+        bad_operands();
+    int pre = size_prefix(a->size);
+    bool w = a->size == 8;
+
+    // imul r, imm is imul r, r, imm.
+    Operand *src = b;
+    Operand *imm = c;
+    if(b->kind == OPD_IMM) {
+        src = a;
+        imm = b;
+    }
+
+    if(imm->kind == OPD_NONE) {
+        out_insn(pre, w, 0x0faf, a->reg, false, src, 0);
+    } else if(!imm->sym && fits8(imm->val)) {
+        out_insn(pre, w, 0x6b, a->reg, false, src, 1);
+        out(imm->val);
+    } else {
+        out_insn(pre, w, 0x69, a->reg, false, src, imm_size(a->size));
+        out_imm(imm, imm_size(a->size), R_X86_64_32S);
+    }
+}
+
+// idiv, div, neg and not: extension `n` of f6/f7
+static void enc_unary(int n, Operand *a, Operand *b, Operand *c) {
+    // idiv rax, rdi is idiv rdi.
+    Operand *opd = (b->kind != OPD_NONE) ? b : a;
+    int size = op_size(opd, opd);
+    out_insn(size_prefix(size), size == 8, size == 1 ? 0xf6 : 0xf7, n, false, opd, 0);
+}
+
+static void enc_test(int arg, Operand *a, Operand *b, Operand *c) {
+    int size = op_size(a, b);
+    int pre = size_prefix(size);
+    bool w = size == 8;
+
+    if(b->kind == OPD_IMM) {
+        if(a->kind == OPD_REG && a->reg == 0)
+            out_short(pre, w, size == 1 ? 0xa8 : 0xa9, 0);
+        else
+            out_insn(pre, w, size == 1 ? 0xf6 : 0xf7, 0, false, a, imm_size(size));
+        out_imm(b, imm_size(size), R_X86_64_32S);
+        return;
+    }
+    if(b->kind != OPD_REG)
+        bad_operands();
+    out_insn(pre, w, size == 1 ? 0x84 : 0x85, b->reg, size == 1, a, 0);
+}
+
+// shl, shr and sar: extension `n` of c0/c1/d0/d1/d2/d3
+static void enc_shift(int n, Operand *a, Operand *b, Operand *c) {
+    int size = op_size(a, a);
+    int pre = size_prefix(size);
+    bool w = size == 8;
+    int byte = (size == 1) ? 0 : 1;
+
+    if(b->kind == OPD_IMM && b->val == 1) {
+        out_insn(pre, w, 0xd0 | byte, n, false, a, 0);
+    } else if(b->kind == OPD_IMM) {
+        out_insn(pre, w, 0xc0 | byte, n, false, a, 1);
+        out(b->val);
+    } else if(b->kind == OPD_REG && b->reg == 1 && b->size == 1) {
+        out_insn(pre, w, 0xd2 | byte, n, false, a, 0);
+    } else {
+        bad_operands();
+    }
+}
+
+// Instructions without operands, e.g. 0x4899 for cqo
+static void enc_fixed(int opcode, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_NONE)
+        bad_operands();
+    out_opcode(opcode);
+}
+
+// rep movsb and rep stosb
+static void enc_rep(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_SYM)
+        bad_operands();
+    out(0xf3);
+    if(!strcmp(a->sym->name, "movsb"))
+        out(0xa4);
+    else if(!strcmp(a->sym->name, "stosb"))
+        out(0xaa);
+    else
+        bad_operands();
+}
+
+static void enc_call(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind == OPD_SYM) {
+        out(0xe8);
+        out_fixup(R_X86_64_PLT32, a->sym, -4, 4);
+    } else if(a->kind == OPD_REG || a->kind == OPD_MEM) {
+        out_insn(0, false, 0xff, 2, false, a, 0);
+    } else {
+        bad_operands();
+    }
+}
+
+// jmp (cond is -1) and jcc to a symbol are sized when the program is
+// laid out.
+static void enc_jump(int cond, Operand *a, Operand *b, Operand *c) {
+    if(cond == -1 && (a->kind == OPD_REG || a->kind == OPD_MEM)) {
+        out_insn(0, false, 0xff, 4, false, a, 0);
+        return;
+    }
+    if(a->kind != OPD_SYM)
+        bad_operands();
+    Frag *frag = end_frag(FR_JUMP);
+    frag->cond = cond;
+    frag->target = a->sym;
+}
+
+static void enc_setcc(int cond, Operand *a, Operand *b, Operand *c) {
+    if(op_size(a, a) != 1)
+        bad_operands();
+    out_insn(0, false, 0x0f90 | cond, 0, false, a, 0);
+}
+
+// SSE2 instructions xmm, xmm/m128 with prefix 66
+static void enc_sse(int opcode, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_XMM || (b->kind != OPD_XMM && b->kind != OPD_MEM))
+        bad_operands();
+    out_insn(0x66, false, 0x0f00 | opcode, a->reg, false, b, 0);
+}
+
+// movdqa (prefix 66) and movdqu (prefix f3)
+static void enc_movdq(int prefix, Operand *a, Operand *b, Operand *c) {
+    if(a->kind == OPD_XMM && (b->kind == OPD_XMM || b->kind == OPD_MEM))
+        out_insn(prefix, false, 0x0f6f, a->reg, false, b, 0);
+    else if(a->kind == OPD_MEM && b->kind == OPD_XMM)
+        out_insn(prefix, false, 0x0f7f, b->reg, false, a, 0);
+    else
+        bad_operands();
+}
+
+static void enc_movd(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind == OPD_XMM && (b->kind == OPD_REG || b->kind == OPD_MEM))
+        out_insn(0x66, b->size == 8, 0x0f6e, a->reg, false, b, 0);
+    else if(b->kind == OPD_XMM && (a->kind == OPD_REG || a->kind == OPD_MEM))
+        out_insn(0x66, a->size == 8, 0x0f7e, b->reg, false, a, 0);
+    else
+        bad_operands();
+}
+
+static void enc_pshufd(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_XMM || c->kind != OPD_IMM)
+        bad_operands();
+    out_insn(0x66, false, 0x0f70, a->reg, false, b, 1);
+    out(c->val);
+}
+
+// Shifts of packed integers by an immediate: 0x7204 is 66 0f 72 /4.
+static void enc_sse_shift(int arg, Operand *a, Operand *b, Operand *c) {
+    if(a->kind != OPD_XMM || b->kind != OPD_IMM)
+        bad_operands();
+    out_insn(0x66, false, 0x0f00 | arg >> 8, arg & 0xff, false, a, 1);
+    out(b->val);
+}
+
+typedef struct {
+    char *name;
+    void (*encode)(int arg, Operand *a, Operand *b, Operand *c);
+    int arg;
+} InsnDef;
+
+static InsnDef insn_defs[] = {
+    {"add", enc_alu, 0},
+    {"or", enc_alu, 1},
+    {"adc", enc_alu, 2},
+    {"sbb", enc_alu, 3},
+    {"and", enc_alu, 4},
+    {"sub", enc_alu, 5},
+    {"xor", enc_alu, 6},
+    {"cmp", enc_alu, 7},
+    {"mov", enc_mov},
+    {"push", enc_push},
+    {"pop", enc_pop},
+    {"lea", enc_lea},
+    {"movsxd", enc_movsxd},
+    {"movsx", enc_movx, 0x0fbe},
+    {"movzx", enc_movx, 0x0fb6},
+    {"movzb", enc_movzb},
+    {"imul", enc_imul},
+    {"not", enc_unary, 2},
+    {"neg", enc_unary, 3},
+    {"div", enc_unary, 6},
+    {"idiv", enc_unary, 7},
+    {"test", enc_test},
+    {"shl", enc_shift, 4},
+    {"sal", enc_shift, 4},
+    {"shr", enc_shift, 5},
+    {"sar", enc_shift, 7},
+    {"cqo", enc_fixed, 0x4899},
+    {"cdq", enc_fixed, 0x99},
+    {"ret", enc_fixed, 0xc3},
+    {"nop", enc_fixed, 0x90},
+    {"rdtsc", enc_fixed, 0x0f31},
+    {"lfence", enc_fixed, 0x0faee8},
+    {"rep", enc_rep},
+    {"call", enc_call},
+    {"jmp", enc_jump, -1},
+    {"movdqa", enc_movdq, 0x66},
+    {"movdqu", enc_movdq, 0xf3},
+    {"movd", enc_movd},
+    {"movq", enc_movd},
+    {"pshufd", enc_pshufd},
+    {"punpcklbw", enc_sse, 0x60},
+    {"punpcklwd", enc_sse, 0x61},
+    {"punpckldq", enc_sse, 0x62},
+    {"punpckhbw", enc_sse, 0x68},
+    {"punpckhwd", enc_sse, 0x69},
+    {"punpckhdq", enc_sse, 0x6a},
+    {"paddq", enc_sse, 0xd4},
+    {"pand", enc_sse, 0xdb},
+    {"por", enc_sse, 0xeb},
+    {"pxor", enc_sse, 0xef},
+    {"psubb", enc_sse, 0xf8},
+    {"psubw", enc_sse, 0xf9},
+    {"psubd", enc_sse, 0xfa},
+    {"psubq", enc_sse, 0xfb},
+    {"paddb", enc_sse, 0xfc},
+    {"paddw", enc_sse, 0xfd},
+    {"paddd", enc_sse, 0xfe},
+    {"psrlw", enc_sse_shift, 0x7102},
+    {"psraw", enc_sse_shift, 0x7104},
+    {"psllw", enc_sse_shift, 0x7106},
+    {"psrld", enc_sse_shift, 0x7202},
+    {"psrad", enc_sse_shift, 0x7204},
+    {"pslld", enc_sse_shift, 0x7206},
+};
+
+// Condition codes in the order of their encoding
+static char *cond_names[][3] = {
+    {"o"}, {"no"}, {"b", "c", "nae"}, {"ae", "nb", "nc"}, {"e", "z"},
+    {"ne", "nz"}, {"be", "na"}, {"a", "nbe"}, {"s"}, {"ns"}, {"p", "pe"},
+    {"np", "po"}, {"l", "nge"}, {"ge", "nl"}, {"le", "ng"}, {"g", "nle"},
+};
+
+static int parse_cond(char *s) {
+    for(int i = 0; i < 16; i++)
+        for(int j = 0; j < 3 && cond_names[i][j]; j++)
+            if(!strcmp(s, cond_names[i][j]))
+                return i;
+    return -1;
+}
+
+//
+// Line numbers
+//
+
+typedef struct LineRow LineRow;
+struct LineRow {
+    LineRow *next;
+    Pos pos;
+    int line;
+    int col;
+};
+
+static char *line_file;
+static LineRow *rows;
+static LineRow *last_row;
+static Section *line_section;
+static bool loc_pending;
+static int loc_line;
+static int loc_col;
+
+// As gives a .loc the address of the instruction after it, or of the
+// next .loc if that comes first.
+static void add_row(void) {
+    if(!loc_pending)
+        return;
+    loc_pending = false;
+    if(line_section && line_section != cur)
+        error("-c: line numbers in more than one section");
+    line_section = cur;
+
+    LineRow *row = alloc(MEM_OUTPUT, sizeof(LineRow));
+    row->pos = here();
+    row->line = loc_line;
+    row->col = loc_col;
+    if(last_row)
+        last_row->next = row;
+    else
+        rows = row;
+    last_row = row;
+}
+
+void asm_insn(char *op, char *dst, char *src) {
+    init();
+    add_row();
+    cur_op = op;
+
+    // The third operand, as in pshufd xmm0, xmm1, 0x4e
+    char *third = NULL;
+    char *comma = src ? strchr(src, ',') : NULL;
+    if(comma && !strchr(src, '[')) {
+        src = strndup(src, comma - src);
+        third = comma + 1;
+        while(*third == ' ')
+            third++;
+    }
+
+    Operand a = parse_operand(dst);
+    Operand b = parse_operand(src);
+    Operand c = parse_operand(third);
+
+    int cond = -1;
+    if(op[0] == 'j' && strcmp(op, "jmp"))
+        cond = parse_cond(op + 1);
+    if(cond != -1) {
+        enc_jump(cond, &a, &b, &c);
+        return;
+    }
+    if(!strncmp(op, "set", 3) && (cond = parse_cond(op + 3)) != -1) {
+        enc_setcc(cond, &a, &b, &c);
+        return;
+    }
+
+    for(int i = 0; i < sizeof(insn_defs) / sizeof(*insn_defs); i++) {
+        if(!strcmp(op, insn_defs[i].name)) {
+            insn_defs[i].encode(insn_defs[i].arg, &a, &b, &c);
+            return;
+        }
+    }
+    error("-c: unknown instruction: %s", op);
+}
+
+//
+// Call frame information
+//
+
+enum {
+    DW_CFA_advance_loc = 0x40,
+    DW_CFA_offset = 0x80,
+    DW_CFA_restore = 0xc0,
+    DW_CFA_advance_loc1 = 0x02,
+    DW_CFA_advance_loc2 = 0x03,
+    DW_CFA_advance_loc4 = 0x04,
+    DW_CFA_remember_state = 0x0a,
+    DW_CFA_restore_state = 0x0b,
+    DW_CFA_def_cfa = 0x0c,
+    DW_CFA_def_cfa_register = 0x0d,
+    DW_CFA_def_cfa_offset = 0x0e,
+};
+
+typedef struct CfiInsn CfiInsn;
+struct CfiInsn {
+    CfiInsn *next;
+    Pos pos;
+    int op;
+    int reg;
+    long val;
+};
+
+typedef struct Fde Fde;
+struct Fde {
+    Fde *next;
+    Section *sec;
+    Pos start;
+    Pos end;
+    CfiInsn *insns;
+    CfiInsn *last;
+};
+
+static Fde *fdes;
+static Fde *last_fde;
+static Fde *cur_fde;
+
+// The CFA offset as of the last directive, for .cfi_adjust_cfa_offset
+static long cfa_offset;
+static long saved_cfa_offsets[16];
+static int num_saved;
+
+// DWARF numbers of the registers in the order of their encoding
+static int dwarf_regs[] = {0, 2, 1, 3, 7, 6, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15};
+
+static int parse_dwarf_reg(char *name) {
+    int size;
+    int reg = parse_reg(name, &size);
+    if(reg == NO_REG || size != 8)
+        error("-c: bad register: %s", name);
+    return dwarf_regs[reg];
+}
+
+static void add_cfi(int op, int reg, long val) {
+    if(!cur_fde)
+        error("-c: CFI directive outside of .cfi_startproc");
+    CfiInsn *ci = alloc(MEM_OUTPUT, sizeof(CfiInsn));
+    ci->pos = here();
+    ci->op = op;
+    ci->reg = reg;
+    ci->val = val;
+    if(cur_fde->last)
+        cur_fde->last->next = ci;
+    else
+        cur_fde->insns = ci;
+    cur_fde->last = ci;
+}
+
+static void out_cfi_insn(CfiInsn *ci) {
+    switch(ci->op) {
+    case DW_CFA_offset:
+        out(DW_CFA_offset | ci->reg);
+        out_uleb(ci->val / -8);
+        return;
+    case DW_CFA_restore:
+        out(DW_CFA_restore | ci->reg);
+        return;
+    case DW_CFA_def_cfa:
+        out(DW_CFA_def_cfa);
+        out_uleb(ci->reg);
+        out_uleb(ci->val);
+        return;
+    case DW_CFA_def_cfa_register:
+        out(DW_CFA_def_cfa_register);
+        out_uleb(ci->reg);
+        return;
+    case DW_CFA_def_cfa_offset:
+        out(DW_CFA_def_cfa_offset);
+        out_uleb(ci->val);
+        return;
+    default:
+        out(ci->op);
+    }
+}
+
+static void out_advance(long delta) {
+    if(delta == 0)
+        return;
+    if(delta < 0x40) {
+        out(DW_CFA_advance_loc | delta);
+    } else if(delta < 0x100) {
+        out(DW_CFA_advance_loc1);
+        out(delta);
+    } else if(delta < 0x10000) {
+        out(DW_CFA_advance_loc2);
+        out_int(delta, 2);
+    } else {
+        out(DW_CFA_advance_loc4);
+        out_int(delta, 4);
+    }
+}
+
+static bool same_pos(Pos a, Pos b) {
+    return a.frag == b.frag && a.off == b.off;
+}
+
+// Returns the first instruction of `fde` that does not belong in the
+// CIE. Like as, the CIE takes the instructions that come before any
+// code of the function.
+static CfiInsn *cie_end(Fde *fde) {
+    CfiInsn *ci = fde->insns;
+    while(ci && same_pos(ci->pos, fde->start) && ci->op != DW_CFA_remember_state)
+        ci = ci->next;
+    return ci;
+}
+
+// Pads a CIE or FDE with DW_CFA_nop. As aligns the last FDE to the
+// alignment of the section and the others to 4 bytes.
+static void pad_entry(int align) {
+    while(cur->last->size % align)
+        out(0);
+}
+
+static void patch_length(long start) {
+    put_int(cur->last->buf.data + start, cur->last->size - start - 4, 4);
+}
+
+typedef struct Cie Cie;
+struct Cie {
+    Cie *next;
+    long offset;
+    CfiInsn *first;
+    CfiInsn *end;
+};
+
+static bool same_insns(CfiInsn *a, CfiInsn *a_end, CfiInsn *b, CfiInsn *b_end) {
+    for(; a != a_end && b != b_end; a = a->next, b = b->next)
+        if(a->op != b->op || a->reg != b->reg || a->val != b->val)
+            return false;
+    return a == a_end && b == b_end;
+}
+
+// Emits a CIE with the initial state of x86-64 functions and the
+// instructions from `first` up to `end`.
+static long out_cie(CfiInsn *first, CfiInsn *end) {
+    long start = cur->last->size;
+    out_int(0, 4);       // length
+    out_int(0, 4);       // CIE id
+    out(1);              // version
+    out_str("zR");       // augmentation
+    out_uleb(1);         // code alignment factor
+    out_sleb(-8);        // data alignment factor
+    out_uleb(16);        // return address register
+    out_uleb(1);         // augmentation data length
+    out(0x1b);           // FDE encoding: pc-relative signed 4 bytes
+    out(DW_CFA_def_cfa);
+    out_uleb(7);
+    out_uleb(8);
+    out(DW_CFA_offset | 16);
+    out_uleb(1);
+    for(CfiInsn *ci = first; ci != end; ci = ci->next)
+        out_cfi_insn(ci);
+    pad_entry(4);
+    patch_length(start);
+    return start;
+}
+
+static void build_eh_frame(void) {
+    if(!fdes)
+        return;
+    cur = new_section(".eh_frame", SHT_PROGBITS, SHF_ALLOC);
+    cur->align = 8;
+
+    Cie *cies = NULL;
+    for(Fde *fde = fdes; fde; fde = fde->next) {
+        CfiInsn *end = cie_end(fde);
+        Cie *cie = cies;
+        while(cie && !same_insns(cie->first, cie->end, fde->insns, end))
+            cie = cie->next;
+        if(!cie) {
+            cie = alloc(MEM_OUTPUT, sizeof(Cie));
+            cie->first = fde->insns;
+            cie->end = end;
+            cie->offset = out_cie(fde->insns, end);
+            cie->next = cies;
+            cies = cie;
+        }
+
+        long start = cur->last->size;
+        out_int(0, 4);
+        out_int(start + 4 - cie->offset, 4);
+        long begin = pos_addr(fde->start);
+        out_fixup(R_X86_64_PC32, section_symbol(fde->sec), begin, 4);
+        out_int(pos_addr(fde->end) - begin, 4);
+        out_uleb(0);
+
+        long addr = begin;
+        for(CfiInsn *ci = end; ci; ci = ci->next) {
+            out_advance(pos_addr(ci->pos) - addr);
+            addr = pos_addr(ci->pos);
+            out_cfi_insn(ci);
+        }
+        pad_entry(fde->next ? 4 : 8);
+        patch_length(start);
+    }
+}
+
+//
+// Directives
+//
+
+// Returns the contents of a quoted string with its escapes decoded.
+static char *parse_string(char *p, int *len) {
+    if(*p != '"')
+        error("-c: expected a string: %s", p);
+    char *buf = alloc(MEM_OUTPUT, strlen(p));
+    int n = 0;
+    for(p++; *p && *p != '"'; p++) {
+        if(*p != '\\') {
+            buf[n++] = *p;
+            continue;
+        }
+        p++;
+        if(*p >= '0' && *p <= '7') {
+            int c = 0;
+            for(int i = 0; i < 3 && *p >= '0' && *p <= '7'; i++)
+                c = c * 8 + *p++ - '0';
+            buf[n++] = c;
+            p--;
+            continue;
+        }
+        switch(*p) {
+        case 'n': buf[n++] = '\n'; break;
+        case 't': buf[n++] = '\t'; break;
+        case 'r': buf[n++] = '\r'; break;
+        case 'b': buf[n++] = '\b'; break;
+        case 'f': buf[n++] = '\f'; break;
+        default: buf[n++] = *p;
+        }
+    }
+    *len = n;
+    return buf;
+}
+
+// Splits "a, b, c" into at most `max` arguments and returns their count.
+static int split_args(char *s, char **args, int max) {
+    int n = 0;
+    while(*s && n < max) {
+        while(*s == ' ' || *s == '\t')
+            s++;
+        char *p = s;
+        bool quoted = false;
+        while(*p && (quoted || *p != ',')) {
+            if(*p == '"' && (p == s || p[-1] != '\\'))
+                quoted = !quoted;
+            p++;
+        }
+        char *end = p;
+        while(end > s && (end[-1] == ' ' || end[-1] == '\t'))
+            end--;
+        args[n++] = strndup(s, end - s);
+        s = *p ? p + 1 : p;
+    }
+    return n;
+}
+
+static void want_args(char *name, int n, int want) {
+    if(n != want)
+        error("-c: bad arguments for %s", name);
+}
+
+static void set_section(char **args, int n) {
+    Section *sec = find_section(args[0]);
+    if(sec) {
+        cur = sec;
+        return;
+    }
+
+    char *name = args[0];
+    int type = SHT_PROGBITS;
+    long flags = 0;
+    if(n == 1) {
+        if(!strncmp(name, ".rodata", 7))
+            flags = SHF_ALLOC;
+        else if(!strncmp(name, ".data", 5))
+            flags = SHF_ALLOC | SHF_WRITE;
+        else if(!strncmp(name, ".text", 5))
+            flags = SHF_ALLOC | SHF_EXECINSTR;
+    } else {
+        for(char *p = args[1]; *p; p++) {
+            if(*p == 'a')
+                flags |= SHF_ALLOC;
+            else if(*p == 'w')
+                flags |= SHF_WRITE;
+            else if(*p == 'x')
+                flags |= SHF_EXECINSTR;
+            else if(*p == 'M')
+                flags |= SHF_MERGE;
+            else if(*p == 'S')
+                flags |= SHF_STRINGS;
+        }
+    }
+    if(n > 2 && !strcmp(args[2], "@nobits"))
+        type = SHT_NOBITS;
+    if(!strcmp(name, ".fini_array"))
+        type = SHT_FINI_ARRAY;
+    else if(!strcmp(name, ".init_array"))
+        type = SHT_INIT_ARRAY;
+
+    cur = new_section(strdup(name), type, flags);
+    if(n > 3)
+        cur->entsize = atoi(args[3]);
+}
+
+static void directive(char *name, char *rest) {
+    while(*rest == ' ' || *rest == '\t')
+        rest++;
+    char *args[4];
+    int n = split_args(rest, args, 4);
+
+    if(!strcmp(name, ".intel_syntax"))
+        return;
+
+    if(!strcmp(name, ".text") || !strcmp(name, ".data") || !strcmp(name, ".bss")) {
+        cur = find_section(name);
+        return;
+    }
+
+    if(!strcmp(name, ".section")) {
+        if(n < 1)
+            want_args(name, n, 1);
+        set_section(args, n);
+        return;
+    }
+
+    if(!strcmp(name, ".file")) {
+        // .file 1 "foo.c"
+        char *p = rest;
+        while(isdigit(*p) || *p == ' ')
+            p++;
+        int len;
+        line_file = parse_string(p, &len);
+        return;
+    }
+
+    if(!strcmp(name, ".loc")) {
+        // .loc file line column
+        add_row();
+        loc_pending = true;
+        char *p;
+        strtol(rest, &p, 10);
+        loc_line = strtol(p, &p, 10);
+        loc_col = strtol(p, &p, 10);
+        return;
+    }
+
+    if(!strcmp(name, ".global") || !strcmp(name, ".globl")) {
+        want_args(name, n, 1);
+        intern(args[0])->global = true;
+        return;
+    }
+
+    if(!strcmp(name, ".type")) {
+        want_args(name, n, 2);
+        Symbol *sym = intern(args[0]);
+        if(!strcmp(args[1], "@function"))
+            sym->type = STT_FUNC;
+        else if(!strcmp(args[1], "@object"))
+            sym->type = STT_OBJECT;
+        else
+            error("-c: unknown symbol type: %s", args[1]);
+        return;
+    }
+
+    if(!strcmp(name, ".size")) {
+        want_args(name, n, 2);
+        Symbol *sym = intern(args[0]);
+        if(!strncmp(args[1], ".-", 2) && !strcmp(args[1] + 2, args[0])) {
+            sym->end = here();
+            sym->has_end = true;
+        } else {
+            sym->size = strtol(args[1], NULL, 0);
+        }
+        return;
+    }
+
+    if(!strcmp(name, ".set")) {
+        want_args(name, n, 2);
+        Symbol *sym = intern(args[0]);
+        Operand opd = {};
+        parse_expr(&opd, args[1]);
+        if(!opd.sym || sym->sec || sym->alias)
+            error("-c: bad .set: %s", rest);
+        sym->alias = opd.sym;
+        sym->offset = opd.val;
+        return;
+    }
+
+    if(!strcmp(name, ".align")) {
+        want_args(name, n, 1);
+        align_frag(atoi(args[0]), -1);
+        return;
+    }
+
+    if(!strcmp(name, ".p2align")) {
+        // .p2align power[, fill[, max]]
+        int max_skip = (n == 3 && *args[2]) ? atoi(args[2]) : -1;
+        align_frag(1 << atoi(args[0]), max_skip);
+        return;
+    }
+
+    if(!strcmp(name, ".zero")) {
+        want_args(name, n, 1);
+        long size = atol(args[0]);
+        if(cur->type == SHT_NOBITS) {
+            cur->last->size += size;
+            return;
+        }
+        for(long i = 0; i < size; i++)
+            out(0);
+        return;
+    }
+
+    if(!strcmp(name, ".string") || !strcmp(name, ".ascii")) {
+        int len;
+        char *s = parse_string(rest, &len);
+        out_bytes(s, len);
+        if(name[1] == 's')
+            out(0);
+        return;
+    }
+
+    if(!strcmp(name, ".quad")) {
+        want_args(name, n, 1);
+        Operand opd = {};
+        parse_expr(&opd, args[0]);
+        if(opd.sym)
+            out_fixup(R_X86_64_64, opd.sym, opd.val, 8);
+        else
+            out_int(opd.val, 8);
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_startproc")) {
+        if(cur_fde)
+            error("-c: nested .cfi_startproc");
+        cur_fde = alloc(MEM_OUTPUT, sizeof(Fde));
+        cur_fde->sec = cur;
+        cur_fde->start = here();
+        cfa_offset = 8;
+        num_saved = 0;
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_endproc")) {
+        if(!cur_fde)
+            error("-c: .cfi_endproc without .cfi_startproc");
+        cur_fde->end = here();
+        if(last_fde)
+            last_fde->next = cur_fde;
+        else
+            fdes = cur_fde;
+        last_fde = cur_fde;
+        cur_fde = NULL;
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_def_cfa")) {
+        want_args(name, n, 2);
+        cfa_offset = atol(args[1]);
+        add_cfi(DW_CFA_def_cfa, parse_dwarf_reg(args[0]), cfa_offset);
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_def_cfa_register")) {
+        want_args(name, n, 1);
+        add_cfi(DW_CFA_def_cfa_register, parse_dwarf_reg(args[0]), 0);
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_def_cfa_offset") || !strcmp(name, ".cfi_adjust_cfa_offset")) {
+        want_args(name, n, 1);
+        if(name[5] == 'a')
+            cfa_offset += atol(args[0]);
+        else
+            cfa_offset = atol(args[0]);
+        add_cfi(DW_CFA_def_cfa_offset, 0, cfa_offset);
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_offset")) {
+        want_args(name, n, 2);
+        add_cfi(DW_CFA_offset, parse_dwarf_reg(args[0]), atol(args[1]));
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_restore")) {
+        want_args(name, n, 1);
+        add_cfi(DW_CFA_restore, parse_dwarf_reg(args[0]), 0);
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_remember_state")) {
+        if(num_saved == sizeof(saved_cfa_offsets) / sizeof(*saved_cfa_offsets))
+            error("-c: .cfi_remember_state nested too deeply");
+        saved_cfa_offsets[num_saved++] = cfa_offset;
+        add_cfi(DW_CFA_remember_state, 0, 0);
+        return;
+    }
+
+    if(!strcmp(name, ".cfi_restore_state")) {
+        if(num_saved == 0)
+            error("-c: .cfi_restore_state without .cfi_remember_state");
+        cfa_offset = saved_cfa_offsets[--num_saved];
+        add_cfi(DW_CFA_restore_state, 0, 0);
+        return;
+    }
+
+    error("-c: unknown directive: %s", name);
+}
+
+void asm_directive(char *line) {
+    init();
+    while(*line == ' ' || *line == '\t')
+        line++;
+    char *p = line;
+    while(*p && *p != ' ' && *p != '\t')
+        p++;
+    char *name = strndup(line, p - line);
+    directive(name, p);
+    free(name);
+}
+
+//
+// Debug information
+//
+
+enum {
+    DW_LNS_copy = 1,
+    DW_LNS_advance_pc = 2,
+    DW_LNS_advance_line = 3,
+    DW_LNS_set_column = 5,
+    DW_LNS_const_add_pc = 8,
+    DW_LNE_end_sequence = 1,
+    DW_LNE_set_address = 2,
+};
+
+#define LINE_BASE -5
+#define LINE_RANGE 14
+#define OPCODE_BASE 13
+#define MAX_SPECIAL_ADDR_DELTA ((255 - OPCODE_BASE) / LINE_RANGE)
+
+// Advances the line by `line_delta` and the address by `addr_delta` and
+// adds a row, or ends the sequence if `line_delta` is INT_MAX. This is
+// the choice of opcodes that as makes.
+static void out_line_addr(int line_delta, long addr_delta) {
+    if(line_delta == INT_MAX) {
+        if(addr_delta == MAX_SPECIAL_ADDR_DELTA) {
+            out(DW_LNS_const_add_pc);
+        } else if(addr_delta) {
+            out(DW_LNS_advance_pc);
+            out_uleb(addr_delta);
+        }
+        out(0);
+        out_uleb(1);
+        out(DW_LNE_end_sequence);
+        return;
+    }
+
+    unsigned tmp = line_delta - LINE_BASE;
+    bool need_copy = false;
+    if(tmp >= LINE_RANGE) {
+        out(DW_LNS_advance_line);
+        out_sleb(line_delta);
+        line_delta = 0;
+        tmp = -LINE_BASE;
+        need_copy = true;
+    }
+
+    if(line_delta == 0 && addr_delta == 0) {
+        out(DW_LNS_copy);
+        return;
+    }
+
+    tmp += OPCODE_BASE;
+    if(addr_delta < 256 + MAX_SPECIAL_ADDR_DELTA) {
+        long opcode = tmp + addr_delta * LINE_RANGE;
+        if(opcode <= 255) {
+            out(opcode);
+            return;
+        }
+        opcode = tmp + (addr_delta - MAX_SPECIAL_ADDR_DELTA) * LINE_RANGE;
+        if(opcode <= 255) {
+            out(DW_LNS_const_add_pc);
+            out(opcode);
+            return;
+        }
+    }
+
+    out(DW_LNS_advance_pc);
+    out_uleb(addr_delta);
+    out(need_copy ? DW_LNS_copy : tmp);
+}
+
+static void build_debug_line(void) {
+    Section *text = line_section;
+    cur = new_section(".debug_line", SHT_PROGBITS, 0);
+
+    out_int(0, 4);            // unit length
+    out_int(3, 2);            // version
+    out_int(0, 4);            // header length
+    long header = cur->last->size;
+    out(1);                   // minimum instruction length
+    out(1);                   // default is_stmt
+    out(LINE_BASE);
+    out(LINE_RANGE);
+    out(OPCODE_BASE);
+    static char std_opcode_lengths[] = {0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1};
+    out_bytes(std_opcode_lengths, sizeof(std_opcode_lengths));
+
+    // Include directories and file names
+    char *slash = strrchr(line_file, '/');
+    if(slash) {
+        char *dir = strndup(line_file, slash - line_file);
+        out_str(*dir ? dir : "/");
+        free(dir);
+    }
+    out(0);
+    out_str(slash ? slash + 1 : line_file);
+    out_uleb(slash ? 1 : 0);
+    out_uleb(0);
+    out_uleb(0);
+    out(0);
+    put_int(cur->last->buf.data + header - 4, cur->last->size - header, 4);
+
+    int line = 1;
+    int col = 0;
+    long addr = 0;
+    for(LineRow *row = rows; row; row = row->next) {
+        if(row->col != col) {
+            out(DW_LNS_set_column);
+            out_uleb(row->col);
+            col = row->col;
+        }
+        if(row == rows) {
+            out(0);
+            out_uleb(9);
+            out(DW_LNE_set_address);
+            out_fixup(R_X86_64_64, section_symbol(text), pos_addr(row->pos), 8);
+            out_line_addr(row->line - line, 0);
+        } else {
+            out_line_addr(row->line - line, pos_addr(row->pos) - addr);
+        }
+        line = row->line;
+        addr = pos_addr(row->pos);
+    }
+    out_line_addr(INT_MAX, text->size - addr);
+    patch_length(0);
+}
+
+enum {
+    DW_TAG_compile_unit = 0x11,
+    DW_AT_name = 0x03,
+    DW_AT_stmt_list = 0x10,
+    DW_AT_low_pc = 0x11,
+    DW_AT_high_pc = 0x12,
+    DW_AT_language = 0x13,
+    DW_AT_comp_dir = 0x1b,
+    DW_AT_producer = 0x25,
+    DW_FORM_addr = 0x01,
+    DW_FORM_data2 = 0x05,
+    DW_FORM_data4 = 0x06,
+    DW_FORM_string = 0x08,
+    DW_LANG_C99 = 0x0c,
+};
+
+// A compilation unit without children that points to the line table,
+// which is what debuggers need to find it.
+static void build_debug_info(void) {
+    Section *text = line_section;
+    Section *line = cur;
+
+    Section *abbrev = new_section(".debug_abbrev", SHT_PROGBITS, 0);
+    cur = abbrev;
+    static char abbrevs[] = {
+        1, DW_TAG_compile_unit, 0,
+        DW_AT_stmt_list, DW_FORM_data4,
+        DW_AT_low_pc, DW_FORM_addr,
+        DW_AT_high_pc, DW_FORM_addr,
+        DW_AT_name, DW_FORM_string,
+        DW_AT_comp_dir, DW_FORM_string,
+        DW_AT_producer, DW_FORM_string,
+        DW_AT_language, DW_FORM_data2,
+        0, 0, 0,
+    };
+    out_bytes(abbrevs, sizeof(abbrevs));
+
+    cur = new_section(".debug_info", SHT_PROGBITS, 0);
+    out_int(0, 4);
+    out_int(3, 2);
+    out_fixup(R_X86_64_32, section_symbol(abbrev), 0, 4);
+    out(8);
+    out_uleb(1);
+    out_fixup(R_X86_64_32, section_symbol(line), 0, 4);
+    out_fixup(R_X86_64_64, section_symbol(text), 0, 8);
+    out_fixup(R_X86_64_64, section_symbol(text), text->size, 8);
+    out_str(line_file);
+    char *dir = getcwd(NULL, 0);
+    out_str(dir ? dir : "");
+    free(dir);
+    out_str("9cc");
+    out_int(DW_LANG_C99, 2);
+    patch_length(0);
+}
+
+//
+// Layout
+//
+
+static long jump_size(Frag *frag) {
+    if(!frag->is_long)
+        return 2;
+    return (frag->cond == -1) ? 5 : 6;
+}
+
+static void set_addrs(Section *sec) {
+    long addr = 0;
+    for(Frag *frag = sec->frags; frag; frag = frag->next) {
+        frag->addr = addr;
+        addr += frag->size;
+        if(frag->kind == FR_ALIGN) {
+            frag->pad = -addr & (frag->align - 1);
+            if(frag->max_skip >= 0 && frag->pad > frag->max_skip)
+                frag->pad = 0;
+            addr += frag->pad;
+        } else if(frag->kind == FR_JUMP) {
+            addr += jump_size(frag);
+        }
+    }
+    sec->size = addr;
+}
+
+// Makes jumps long until every displacement fits. A jump to a symbol
+// in another section or not defined here is long from the start.
+static void relax(Section *sec) {
+    for(Frag *frag = sec->frags; frag; frag = frag->next)
+        if(frag->kind == FR_JUMP)
+            frag->is_long = sym_section(frag->target) != sec;
+
+    for(;;) {
+        set_addrs(sec);
+        bool changed = false;
+        for(Frag *frag = sec->frags; frag; frag = frag->next) {
+            if(frag->kind != FR_JUMP || frag->is_long)
+                continue;
+            long disp = sym_value(frag->target) - (frag->addr + frag->size + 2);
+            if(!fits8(disp)) {
+                frag->is_long = true;
+                changed = true;
+            }
+        }
+        if(!changed)
+            return;
+    }
+}
+
+static void add_reloc(Section *sec, long offset, int type, Symbol *sym, long addend) {
+    // As refers to local symbols through the section symbol, except in
+    // a mergeable section when the addend would point away from the
+    // symbol, which the linker could not tell apart from another string.
+    Section *target = sym_section(sym);
+    if(target && !sym->global && !sym->is_section &&
+       !((target->flags & SHF_MERGE) && addend != 0)) {
+        addend += sym_value(sym);
+        sym = section_symbol(target);
+    }
+    sym->used = true;
+
+    Reloc *rel = alloc(MEM_OUTPUT, sizeof(Reloc));
+    rel->offset = offset;
+    rel->type = type;
+    rel->sym = sym;
+    rel->addend = addend;
+    if(sec->last_reloc)
+        sec->last_reloc->next = rel;
+    else
+        sec->relocs = rel;
+    sec->last_reloc = rel;
+    sec->nrelocs++;
+}
+
+// NOP instructions of 1 to 11 bytes for padding in code
+static char *nops[] = {
+    "",
+    "\x90",
+    "\x66\x90",
+    "\x0f\x1f\x00",
+    "\x0f\x1f\x40\x00",
+    "\x0f\x1f\x44\x00\x00",
+    "\x66\x0f\x1f\x44\x00\x00",
+    "\x0f\x1f\x80\x00\x00\x00\x00",
+    "\x0f\x1f\x84\x00\x00\x00\x00\x00",
+    "\x66\x0f\x1f\x84\x00\x00\x00\x00\x00",
+    "\x66\x2e\x0f\x1f\x84\x00\x00\x00\x00\x00",
+    "\x66\x66\x2e\x0f\x1f\x84\x00\x00\x00\x00\x00",
+};
+
+static void out_padding(Section *sec, int pad) {
+    Buf *buf = &sec->data;
+    if(!(sec->flags & SHF_EXECINSTR)) {
+        for(int i = 0; i < pad; i++)
+            buf_add(buf, "", 1);
+        return;
+    }
+    for(; pad > 11; pad -= 11)
+        buf_add(buf, nops[11], 11);
+    buf_add(buf, nops[pad], pad);
+}
+
+static void out_jump(Section *sec, Frag *frag) {
+    unsigned char code[6];
+    int len = 0;
+    if(!frag->is_long) {
+        code[len++] = (frag->cond == -1) ? 0xeb : 0x70 | frag->cond;
+    } else if(frag->cond == -1) {
+        code[len++] = 0xe9;
+    } else {
+        code[len++] = 0x0f;
+        code[len++] = 0x80 | frag->cond;
+    }
+
+    long end = frag->addr + frag->size + jump_size(frag);
+    Symbol *sym = frag->target;
+    if(!frag->is_long) {
+        code[len++] = sym_value(sym) - end;
+    } else if(sym_section(sym) == sec) {
+        put_int(code + len, sym_value(sym) - end, 4);
+        len += 4;
+    } else {
+        int type = (sym->global || !sym->sec) ? R_X86_64_PLT32 : R_X86_64_PC32;
+        add_reloc(sec, end - 4, type, sym, -4);
+        put_int(code + len, 0, 4);
+        len += 4;
+    }
+    buf_add(&sec->data, code, len);
+}
+
+// Lays out the fragments of `sec` in sec->data and turns its fixups
+// into relocations, or resolves them where the result is known.
+static void finish_section(Section *sec) {
+    if(sec->type != SHT_NOBITS) {
+        for(Frag *frag = sec->frags; frag; frag = frag->next) {
+            buf_add(&sec->data, frag->buf.data, frag->size);
+            if(frag->kind == FR_ALIGN)
+                out_padding(sec, frag->pad);
+            else if(frag->kind == FR_JUMP)
+                out_jump(sec, frag);
+        }
+    }
+
+    // Relocations of jumps come first, so put them in order.
+    Reloc *jumps = sec->relocs;
+    sec->relocs = sec->last_reloc = NULL;
+    int njumps = sec->nrelocs;
+    sec->nrelocs = 0;
+
+    for(Fixup *fix = sec->fixups; fix; fix = fix->next) {
+        long offset = pos_addr(fix->pos);
+        while(jumps && jumps->offset < offset) {
+            Reloc *next = jumps->next;
+            add_reloc(sec, jumps->offset, jumps->type, jumps->sym, jumps->addend);
+            jumps = next;
+            njumps--;
+        }
+
+        bool pcrel = fix->type == R_X86_64_PC32 || fix->type == R_X86_64_PLT32;
+        Symbol *sym = fix->sym;
+        if(pcrel && sym_section(sym) == sec && !sym->global) {
+            put_int(sec->data.data + offset, sym_value(sym) + fix->addend - offset, fix->size);
+            continue;
+        }
+        add_reloc(sec, offset, fix->type, sym, fix->addend);
+    }
+    for(; jumps; jumps = jumps->next)
+        add_reloc(sec, jumps->offset, jumps->type, jumps->sym, jumps->addend);
+}
+
+//
+// ELF output
+//
+
+static void strtab_add(Buf *strtab, char *s, int *index) {
+    *index = strtab->len;
+    buf_add(strtab, s, strlen(s) + 1);
+}
+
+static bool in_symtab(Symbol *sym) {
+    if(!sym->sec && !sym->alias)
+        return sym->used || sym->global;
+    return sym->used || sym->global || !is_local_label(sym);
+}
+
+static void add_symbol(Buf *symtab, Buf *strtab, Symbol *sym) {
+    Elf64_Sym esym = {};
+    Section *sec = sym_section(sym);
+    if(!sym->is_section) {
+        int name;
+        strtab_add(strtab, sym->name, &name);
+        esym.st_name = name;
+    }
+    int bind = (sym->global || !sec) ? STB_GLOBAL : STB_LOCAL;
+    esym.st_info = ELF64_ST_INFO(bind, sym->type);
+    esym.st_shndx = sec ? sec->index : SHN_UNDEF;
+    esym.st_value = sym_value(sym);
+    esym.st_size = sym->has_end ? pos_addr(sym->end) - sym_value(sym) : sym->size;
+    sym->index = symtab->len / sizeof(Elf64_Sym);
+    buf_add(symtab, &esym, sizeof(esym));
+}
+
+static long align_offset(Buf *obj, int align) {
+    static char zeros[16];
+    buf_add(obj, zeros, -obj->len & (align - 1));
+    return obj->len;
+}
+
+void write_object(FILE *out) {
+    init();
+    add_row();
+    if(cur_fde)
+        error("-c: missing .cfi_endproc");
+
+    for(Section *sec = sections; sec; sec = sec->next)
+        relax(sec);
+
+    Section *last = last_section;
+    if(rows) {
+        if(!line_file)
+            error("-c: .loc without .file");
+        build_debug_line();
+        build_debug_info();
+    }
+    build_eh_frame();
+    for(Section *sec = last->next; sec; sec = sec->next)
+        set_addrs(sec);
+    for(Section *sec = sections; sec; sec = sec->next)
+        finish_section(sec);
+
+    // Section header table: the sections, each followed by its
+    // relocations, then the symbol and string tables.
+    int nsecs = 1;
+    for(Section *sec = sections; sec; sec = sec->next) {
+        sec->index = nsecs++;
+        if(sec->nrelocs)
+            sec->rela_index = nsecs++;
+    }
+    int symtab_index = nsecs++;
+    int strtab_index = nsecs++;
+    int shstrtab_index = nsecs++;
+
+    // Local symbols come before global ones.
+    Buf symtab = {};
+    Buf strtab = {};
+    Elf64_Sym null_sym = {};
+    buf_add(&symtab, &null_sym, sizeof(null_sym));
+    buf_add(&strtab, "", 1);
+    for(Section *sec = sections; sec; sec = sec->next)
+        if(sec->sym && sec->sym->used)
+            add_symbol(&symtab, &strtab, sec->sym);
+    for(Symbol *sym = symbols; sym; sym = sym->next)
+        if(in_symtab(sym) && !sym->global && sym_section(sym))
+            add_symbol(&symtab, &strtab, sym);
+    int first_global = symtab.len / sizeof(Elf64_Sym);
+    for(Symbol *sym = symbols; sym; sym = sym->next)
+        if(in_symtab(sym) && (sym->global || !sym_section(sym)))
+            add_symbol(&symtab, &strtab, sym);
+
+    Buf shstrtab = {};
+    buf_add(&shstrtab, "", 1);
+    int name_symtab, name_strtab, name_shstrtab;
+    strtab_add(&shstrtab, ".symtab", &name_symtab);
+    strtab_add(&shstrtab, ".strtab", &name_strtab);
+    strtab_add(&shstrtab, ".shstrtab", &name_shstrtab);
+
+    // Contents in the order of the section headers. The object is
+    // built in memory since the output may be a pipe.
+    Buf obj = {};
+    Elf64_Ehdr ehdr = {};
+    buf_add(&obj, &ehdr, sizeof(ehdr));
+    Buf shdrs = {};
+    Elf64_Shdr null_shdr = {};
+    buf_add(&shdrs, &null_shdr, sizeof(null_shdr));
+
+    for(Section *sec = sections; sec; sec = sec->next) {
+        Elf64_Shdr shdr = {};
+        int name;
+        strtab_add(&shstrtab, sec->name, &name);
+        shdr.sh_name = name;
+        shdr.sh_type = sec->type;
+        shdr.sh_flags = sec->flags;
+        shdr.sh_offset = align_offset(&obj, sec->align);
+        shdr.sh_size = sec->size;
+        shdr.sh_addralign = sec->align;
+        shdr.sh_entsize = sec->entsize;
+        if(sec->type != SHT_NOBITS)
+            buf_add(&obj, sec->data.data, sec->size);
+        buf_add(&shdrs, &shdr, sizeof(shdr));
+
+        if(!sec->nrelocs)
+            continue;
+        Elf64_Shdr rela = {};
+        char *rela_name;
+        asprintf(&rela_name, ".rela%s", sec->name);
+        strtab_add(&shstrtab, rela_name, &name);
+        free(rela_name);
+        rela.sh_name = name;
+        rela.sh_type = SHT_RELA;
+        rela.sh_flags = SHF_INFO_LINK;
+        rela.sh_offset = align_offset(&obj, 8);
+        rela.sh_size = sec->nrelocs * sizeof(Elf64_Rela);
+        rela.sh_link = symtab_index;
+        rela.sh_info = sec->index;
+        rela.sh_addralign = 8;
+        rela.sh_entsize = sizeof(Elf64_Rela);
+        for(Reloc *rel = sec->relocs; rel; rel = rel->next) {
+            Elf64_Rela erel = {};
+            erel.r_offset = rel->offset;
+            erel.r_info = ELF64_R_INFO(rel->sym->index, rel->type);
+            erel.r_addend = rel->addend;
+            buf_add(&obj, &erel, sizeof(erel));
+        }
+        buf_add(&shdrs, &rela, sizeof(rela));
+    }
+
+    Elf64_Shdr shdr = {};
+    shdr.sh_name = name_symtab;
+    shdr.sh_type = SHT_SYMTAB;
+    shdr.sh_offset = align_offset(&obj, 8);
+    shdr.sh_size = symtab.len;
+    shdr.sh_link = strtab_index;
+    shdr.sh_info = first_global;
+    shdr.sh_addralign = 8;
+    shdr.sh_entsize = sizeof(Elf64_Sym);
+    buf_add(&obj, symtab.data, symtab.len);
+    buf_add(&shdrs, &shdr, sizeof(shdr));
+
+    shdr = (Elf64_Shdr){};
+    shdr.sh_name = name_strtab;
+    shdr.sh_type = SHT_STRTAB;
+    shdr.sh_offset = obj.len;
+    shdr.sh_size = strtab.len;
+    shdr.sh_addralign = 1;
+    buf_add(&obj, strtab.data, strtab.len);
+    buf_add(&shdrs, &shdr, sizeof(shdr));
+
+    shdr = (Elf64_Shdr){};
+    shdr.sh_name = name_shstrtab;
+    shdr.sh_type = SHT_STRTAB;
+    shdr.sh_offset = obj.len;
+    shdr.sh_size = shstrtab.len;
+    shdr.sh_addralign = 1;
+    buf_add(&obj, shstrtab.data, shstrtab.len);
+    buf_add(&shdrs, &shdr, sizeof(shdr));
+
+    ehdr.e_shoff = align_offset(&obj, 8);
+    buf_add(&obj, shdrs.data, shdrs.len);
+
+    memcpy(ehdr.e_ident, ELFMAG, SELFMAG);
+    ehdr.e_ident[EI_CLASS] = ELFCLASS64;
+    ehdr.e_ident[EI_DATA] = ELFDATA2LSB;
+    ehdr.e_ident[EI_VERSION] = EV_CURRENT;
+    ehdr.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    ehdr.e_type = ET_REL;
+    ehdr.e_machine = EM_X86_64;
+    ehdr.e_version = EV_CURRENT;
+    ehdr.e_ehsize = sizeof(Elf64_Ehdr);
+    ehdr.e_shentsize = sizeof(Elf64_Shdr);
+    ehdr.e_shnum = nsecs;
+    ehdr.e_shstrndx = shstrtab_index;
+    memcpy(obj.data, &ehdr, sizeof(ehdr));
+
+    if(fwrite(obj.data, obj.len, 1, out) != 1)
+        error("-c: cannot write the object file: %s", strerror(errno));
+    stats.asm_bytes = obj.len;
+}
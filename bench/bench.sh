@@ -0,0 +1,101 @@
+#!/bin/bash
+#
+# Compile-throughput benchmark
+#
+# usage: bench/bench.sh [--update]
+#
+# For each kind of input made by bench/gen, compiles a program of size n
+# and one of size 4n and reports the compile time, tokens per second,
+# peak RSS and bytes of assembly. Times are the best of $RUNS runs as
+# measured by -ftime-report.
+#
+# Absolute times depend on the machine, so the check is on how they
+# scale: the exponent log(t(4n) / t(n)) / log(4) is 1 when compile time
+# is linear in the input. A kind whose exponent is more than $THRESHOLD
+# above 1 fails the benchmark, except for the kinds in EXEMPT, which are
+# known to be super-linear and are held to the exponent recorded in
+# bench/baseline.txt instead. --update rewrites the baseline with the
+# exponents of this run.
+
+RUNS=${RUNS:-3}
+THRESHOLD=${THRESHOLD:-0.3}
+BASELINE=bench/baseline.txt
+
+# Kinds allowed to scale worse than linearly, and why
+EXEMPT="
+globals  parse: a variable lookup walks every global declared before it
+nest     type: add_type revisits the statements nested in each one
+"
+
+# kind and n
+SIZES="
+funcs 500
+globals 1000
+nest 300
+expr 500
+string 200000
+struct 500
+"
+
+tmp=$(mktemp -d)
+trap 'rm -rf $tmp' EXIT
+
+# Prints the value of a number in the JSON of -ftime-report=json.
+json() {
+    grep "\"$1\"" $tmp/report.json | head -1 | sed 's/.*: *//; s/[,}]*$//'
+}
+
+# Compiles bench/gen $1 $2 and sets time (ms), tokens, rss and bytes.
+measure() {
+    ./bench/gen $1 $2 > $tmp/in.c || exit 1
+    time=
+    for i in $(seq $RUNS); do
+        ./9cc -ftime-report=json -o $tmp/out.s $tmp/in.c 2> $tmp/report.json || exit 1
+        t=$(awk -F'"wall": ' '/"wall"/ { split($2, a, ","); s += a[1] } END { printf "%.3f", s * 1000 }' $tmp/report.json)
+        if [ -z "$time" ] || awk "BEGIN { exit !($t < $time) }"; then
+            time=$t
+        fi
+    done
+    tokens=$(json tokens)
+    rss=$(json peak_rss_kb)
+    bytes=$(json asm_bytes)
+}
+
+update=false
+[ "$1" = "--update" ] && update=true
+$update && : > $BASELINE.new
+
+printf "%-8s %8s %10s %12s %9s %10s %8s %8s\n" \
+       kind n ms tokens/s rss-KB asm-bytes exp base
+failed=0
+while read kind n; do
+    [ -z "$kind" ] && continue
+
+    measure $kind $n
+    t1=$time
+    measure $kind $((n * 4))
+    t4=$time
+    exp=$(awk "BEGIN { printf \"%.2f\", log($t4 / $t1) / log(4) }")
+    base=$(awk -v k=$kind '$1 == k { print $3 }' $BASELINE 2> /dev/null)
+    limit=1.0
+    if grep -q "^$kind " <<< "$EXEMPT"; then
+        limit=${base:-1.0}
+    fi
+    rate=$(awk "BEGIN { printf \"%d\", $tokens / ($t4 / 1000) }")
+
+    status=
+    if awk "BEGIN { exit !($exp > $limit + $THRESHOLD) }"; then
+        status="  super-linear regression"
+        failed=1
+    fi
+    printf "%-8s %8d %10.1f %12d %9d %10d %8s %8s%s\n" \
+           $kind $((n * 4)) $t4 $rate $rss $bytes $exp "${base:--}" "$status"
+    $update && echo "$kind $n $exp" >> $BASELINE.new
+done <<< "$SIZES"
+
+if $update; then
+    mv $BASELINE.new $BASELINE
+    echo "updated $BASELINE"
+    exit 0
+fi
+exit $failed
@@ -0,0 +1,104 @@
+// Generates C programs in the subset 9cc accepts for `make bench`.
+//
+// usage: gen <kind> <n>
+//
+//   funcs    n small functions called from main
+//   globals  n global variables, each assigned and read by main
+//   nest     "if" statements nested n deep
+//   expr     an expression of n terms
+//   string   a string literal of n bytes
+//   struct   a struct with n members, each assigned and read by main
+//
+// Every program returns 0 when compiled correctly.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void gen_funcs(int n) {
+    for(int i = 0; i < n; i++) {
+        printf("int f%d(int x) {\n", i);
+        printf("    int y;\n");
+        printf("    y = x * 3 + %d;\n", i % 7);
+        printf("    if (y > 100) return y - x;\n");
+        printf("    return y + x;\n");
+        printf("}\n");
+    }
+    printf("int main() {\n    int s;\n    s = 0;\n");
+    for(int i = 0; i < n; i++)
+        printf("    s = s + f%d(%d);\n", i, i % 5);
+    printf("    return s - s;\n}\n");
+}
+
+static void gen_globals(int n) {
+    for(int i = 0; i < n; i++)
+        printf("int g%d;\n", i);
+    printf("int main() {\n    int s;\n    s = 0;\n");
+    for(int i = 0; i < n; i++)
+        printf("    g%d = %d;\n", i, i % 10);
+    for(int i = 0; i < n; i++)
+        printf("    s = s + g%d;\n", i);
+    printf("    return s - s;\n}\n");
+}
+
+static void gen_nest(int n) {
+    printf("int main() {\n    int x;\n    x = 0;\n");
+    for(int i = 0; i < n; i++)
+        printf("if (x < %d) {\n", i + 1);
+    printf("x = x + 1;\n");
+    for(int i = 0; i < n; i++)
+        printf("}\n");
+    printf("    return x - 1;\n}\n");
+}
+
+static void gen_expr(int n) {
+    printf("int main() {\n    int x;\n    x = 1;\n    return x - 1");
+    for(int i = 0; i < n; i++)
+        printf(" + x * %d - %d", i % 9 + 1, i % 9 + 1);
+    printf(";\n}\n");
+}
+
+static void gen_string(int n) {
+    printf("int main() {\n    char *s;\n    s = \"");
+    for(int i = 0; i < n; i++)
+        putchar('a' + i % 26);
+    printf("\";\n    return s[0] - 97;\n}\n");
+}
+
+static void gen_struct(int n) {
+    printf("int main() {\n    struct {\n");
+    for(int i = 0; i < n; i++)
+        printf("        int m%d;\n", i);
+    printf("    } s;\n    int t;\n    t = 0;\n");
+    for(int i = 0; i < n; i++)
+        printf("    s.m%d = %d;\n", i, i % 10);
+    for(int i = 0; i < n; i++)
+        printf("    t = t + s.m%d;\n", i);
+    printf("    return t - t;\n}\n");
+}
+
+int main(int argc, char **argv) {
+    if(argc != 3) {
+        fprintf(stderr, "usage: gen <kind> <n>\n");
+        return 1;
+    }
+
+    char *kind = argv[1];
+    int n = atoi(argv[2]);
+    if(!strcmp(kind, "funcs"))
+        gen_funcs(n);
+    else if(!strcmp(kind, "globals"))
+        gen_globals(n);
+    else if(!strcmp(kind, "nest"))
+        gen_nest(n);
+    else if(!strcmp(kind, "expr"))
+        gen_expr(n);
+    else if(!strcmp(kind, "string"))
+        gen_string(n);
+    else if(!strcmp(kind, "struct"))
+        gen_struct(n);
+    else {
+        fprintf(stderr, "gen: unknown kind: %s\n", kind);
+        return 1;
+    }
+    return 0;
+}
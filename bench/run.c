@@ -0,0 +1,120 @@
+// Runs a program repeatedly for `make bench-runtime`.
+//
+// usage: run <reps> <program>
+//
+// Prints the median wall time in milliseconds and the median number of
+// user-space instructions retired, or "-" where the kernel does not
+// provide an instruction counter. The output of the program is
+// discarded.
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+// Counts the instructions of `pid` from its next exec on.
+static int open_counter(pid_t pid) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.enable_on_exec = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(SYS_perf_event_open, &attr, pid, -1, -1, 0);
+}
+
+// Runs `prog` once. Returns the wall time and sets *insns, or -1 there.
+static double run(char *prog, long *insns) {
+    int fds[2];
+    if(pipe(fds) < 0) {
+        perror("pipe");
+        exit(1);
+    }
+
+    pid_t pid = fork();
+    if(pid == 0) {
+        // Wait until the counter is set up.
+        char c;
+        close(fds[1]);
+        if(read(fds[0], &c, 1) < 0)
+            _exit(127);
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        execl(prog, prog, (char *)NULL);
+        perror(prog);
+        _exit(127);
+    }
+
+    close(fds[0]);
+    int fd = open_counter(pid);
+    double start = now();
+    if(write(fds[1], "x", 1) < 0) {
+        perror("write");
+        exit(1);
+    }
+    close(fds[1]);
+
+    int status;
+    waitpid(pid, &status, 0);
+    double time = now() - start;
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "run: %s failed\n", prog);
+        exit(1);
+    }
+
+    *insns = -1;
+    if(fd >= 0) {
+        long n;
+        if(read(fd, &n, sizeof(n)) == sizeof(n))
+            *insns = n;
+        close(fd);
+    }
+    return time;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(double *)a, y = *(double *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_long(const void *a, const void *b) {
+    long x = *(long *)a, y = *(long *)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv) {
+    if(argc != 3) {
+        fprintf(stderr, "usage: run <reps> <program>\n");
+        return 1;
+    }
+
+    int reps = atoi(argv[1]);
+    if(reps < 1)
+        reps = 1;
+    double *times = calloc(reps, sizeof(double));
+    long *insns = calloc(reps, sizeof(long));
+    for(int i = 0; i < reps; i++)
+        times[i] = run(argv[2], &insns[i]);
+
+    qsort(times, reps, sizeof(double), cmp_double);
+    qsort(insns, reps, sizeof(long), cmp_long);
+    printf("%.1f ", times[reps / 2]);
+    if(insns[reps / 2] < 0)
+        printf("-\n");
+    else
+        printf("%ld\n", insns[reps / 2]);
+    return 0;
+}
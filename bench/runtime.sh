@@ -0,0 +1,63 @@
+#!/bin/bash
+#
+# Generated-code runtime benchmark
+#
+# usage: bench/runtime.sh [9cc flags...]
+#
+# Compiles each kernel in bench/runtime with 9cc (given the flags on the
+# command line) and with gcc -O0 and -O2. It checks that all three
+# print the same result, then runs each binary $RUNS times with
+# bench/run. The report shows median wall time, median instructions
+# retired (where the kernel has a counter for them), the size of the
+# kernel's .text, and the speed relative to gcc -O0.
+
+RUNS=${RUNS:-5}
+CC=${CC:-gcc}
+
+tmp=$(mktemp -d)
+trap 'rm -rf $tmp' EXIT
+
+# Builds $tmp/$2 and $tmp/$2.o from kernel $1 with compiler $2.
+build() {
+    case $2 in
+    9cc)
+        ./9cc "${FLAGS[@]}" -o $tmp/9cc.s $1 || exit 1
+        $CC -c -o $tmp/9cc.o $tmp/9cc.s || exit 1
+        ;;
+    gcc-O0|gcc-O2)
+        $CC -w -${2#gcc-} -c -o $tmp/$2.o $1 || exit 1
+        ;;
+    esac
+    $CC -static -o $tmp/$2 $tmp/$2.o 2> /dev/null || exit 1
+}
+
+text_size() {
+    size -A $1 | awk '$1 == ".text" { print $2 }'
+}
+
+FLAGS=("$@")
+printf "%-10s %-8s %10s %14s %8s %8s\n" kernel compiler ms instructions text vs-O0
+for src in bench/runtime/*.c; do
+    kernel=$(basename $src .c)
+
+    for cc in 9cc gcc-O0 gcc-O2; do
+        build $src $cc
+    done
+    expected=$($tmp/gcc-O2)
+    for cc in 9cc gcc-O0; do
+        actual=$($tmp/$cc)
+        if [ "$actual" != "$expected" ]; then
+            echo "$kernel: $cc printed $actual, expected $expected"
+            exit 1
+        fi
+    done
+
+    base=
+    for cc in gcc-O0 9cc gcc-O2; do
+        read ms insns <<< "$(./bench/run $RUNS $tmp/$cc)"
+        [ -z "$base" ] && base=$ms
+        speedup=$(awk "BEGIN { printf \"%.2fx\", $base / $ms }")
+        printf "%-10s %-8s %10s %14s %8s %8s\n" \
+               $kernel $cc $ms $insns $(text_size $tmp/$cc.o) $speedup
+    done
+done
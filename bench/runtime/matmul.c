@@ -0,0 +1,44 @@
+// Product of two 200x200 integer matrices, 5 times
+int printf();
+
+int a[200][200];
+int b[200][200];
+int c[200][200];
+
+int matmul(int n) {
+    int i;
+    int j;
+    int k;
+    for (i = 0; i < n; i = i + 1) {
+        for (j = 0; j < n; j = j + 1) {
+            int s = 0;
+            for (k = 0; k < n; k = k + 1)
+                s = s + a[i][k] * b[k][j];
+            c[i][j] = s;
+        }
+    }
+    return 0;
+}
+
+int main() {
+    int i;
+    int j;
+    int k;
+    int n = 200;
+    for (i = 0; i < n; i = i + 1) {
+        for (j = 0; j < n; j = j + 1) {
+            a[i][j] = i + j;
+            b[i][j] = i - j;
+        }
+    }
+
+    for (k = 0; k < 5; k = k + 1)
+        matmul(n);
+
+    long sum = 0;
+    for (i = 0; i < n; i = i + 1)
+        for (j = 0; j < n; j = j + 1)
+            sum = sum + c[i][j];
+    printf("%ld\n", sum);
+    return 0;
+}
@@ -0,0 +1,40 @@
+// The 8 queens problem of example/8queensproblem.c, solved 200 times
+int printf();
+
+int t[8];
+int sol;
+
+int absval(int a) {
+    if (a < 0)
+        return 0 - a;
+    return a;
+}
+
+int empty(int i) {
+    int j = 0;
+    while ((t[i] != t[j]) && (absval(t[i] - t[j]) != (i - j)) && j < 8)
+        j = j + 1;
+    if (i == j)
+        return 1;
+    return 0;
+}
+
+int queens(int i) {
+    for (t[i] = 0; t[i] < 8; t[i] = t[i] + 1) {
+        if (empty(i)) {
+            if (i == 7)
+                sol = sol + 1;
+            else
+                queens(i + 1);
+        }
+    }
+    return 0;
+}
+
+int main() {
+    int k;
+    for (k = 0; k < 200; k = k + 1)
+        queens(0);
+    printf("%d\n", sol);
+    return 0;
+}
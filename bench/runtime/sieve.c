@@ -0,0 +1,31 @@
+// Sieve of Eratosthenes up to 2000000, 10 times
+int printf();
+
+char composite[2000001];
+
+int sieve(int n) {
+    int i;
+    long j;
+    for (i = 0; i <= n; i = i + 1)
+        composite[i] = 0;
+
+    int count = 0;
+    for (i = 2; i <= n; i = i + 1) {
+        if (!composite[i]) {
+            count = count + 1;
+            j = i;
+            for (j = j * i; j <= n; j = j + i)
+                composite[j] = 1;
+        }
+    }
+    return count;
+}
+
+int main() {
+    int k;
+    int count = 0;
+    for (k = 0; k < 10; k = k + 1)
+        count = sieve(2000000);
+    printf("%d\n", count);
+    return 0;
+}
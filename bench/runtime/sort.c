@@ -0,0 +1,58 @@
+// Quicksort of 300000 pseudo-random integers, 5 times
+int printf();
+
+int v[300000];
+int seed;
+
+int rand31() {
+    seed = seed * 1103515245 + 12345;
+    int r = seed / 65536;
+    if (r < 0)
+        r = 0 - r;
+    return r;
+}
+
+int quicksort(int *p, int n) {
+    while (n > 1) {
+        int pivot = p[n / 2];
+        int i = 0;
+        int j = n - 1;
+        while (i <= j) {
+            while (p[i] < pivot)
+                i = i + 1;
+            while (p[j] > pivot)
+                j = j - 1;
+            if (i <= j) {
+                int t = p[i];
+                p[i] = p[j];
+                p[j] = t;
+                i = i + 1;
+                j = j - 1;
+            }
+        }
+        // Recurse on the left part and loop on the right one.
+        quicksort(p, j + 1);
+        p = p + i;
+        n = n - i;
+    }
+    return 0;
+}
+
+int main() {
+    int i;
+    int k;
+    int n = 300000;
+    long check = 0;
+    seed = 1;
+    for (k = 0; k < 5; k = k + 1) {
+        for (i = 0; i < n; i = i + 1)
+            v[i] = rand31();
+        quicksort(v, n);
+        for (i = 1; i < n; i = i + 1)
+            if (v[i - 1] > v[i])
+                return 1;
+        check = check + v[n / 2];
+    }
+    printf("%ld\n", check);
+    return 0;
+}
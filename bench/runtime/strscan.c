@@ -0,0 +1,57 @@
+// Counting words and a substring in a 1MB buffer, 20 times
+int printf();
+
+char buf[1000001];
+
+int fill(int n) {
+    char *words = "the quick brown fox jumps over the lazy dog ";
+    int len = 0;
+    while (words[len])
+        len = len + 1;
+    int i;
+    int k = 0;
+    for (i = 0; i < n; i = i + 1) {
+        buf[i] = words[k];
+        k = k + 1;
+        if (k == len)
+            k = 0;
+    }
+    buf[n] = 0;
+    return 0;
+}
+
+int count_words(char *s) {
+    int n = 0;
+    int in_word = 0;
+    for (; *s; s = s + 1) {
+        if (*s == 32) {
+            in_word = 0;
+        } else if (!in_word) {
+            in_word = 1;
+            n = n + 1;
+        }
+    }
+    return n;
+}
+
+int count_match(char *s, char *pat) {
+    int n = 0;
+    for (; *s; s = s + 1) {
+        int i = 0;
+        while (pat[i] && s[i] == pat[i])
+            i = i + 1;
+        if (!pat[i])
+            n = n + 1;
+    }
+    return n;
+}
+
+int main() {
+    int k;
+    fill(1000000);
+    long total = 0;
+    for (k = 0; k < 20; k = k + 1)
+        total = total + count_words(buf) + count_match(buf, "the");
+    printf("%ld\n", total);
+    return 0;
+}
@@ -0,0 +1,50 @@
+// Moving 10000 particles in a box for 5000 steps
+int printf();
+
+struct Particle {
+    int x;
+    int y;
+    int vx;
+    int vy;
+    int bounces;
+} ps[10000];
+
+int step(struct Particle *p, int size) {
+    p->x = p->x + p->vx;
+    p->y = p->y + p->vy;
+    if (p->x < 0 || p->x >= size) {
+        p->vx = 0 - p->vx;
+        p->x = p->x + p->vx;
+        p->bounces = p->bounces + 1;
+    }
+    if (p->y < 0 || p->y >= size) {
+        p->vy = 0 - p->vy;
+        p->y = p->y + p->vy;
+        p->bounces = p->bounces + 1;
+    }
+    return 0;
+}
+
+int main() {
+    int i;
+    int t;
+    int n = 10000;
+    int size = 1000;
+    for (i = 0; i < n; i = i + 1) {
+        ps[i].x = i / 10;
+        ps[i].y = i / 13;
+        ps[i].vx = i - i / 7 * 7 - 3;
+        ps[i].vy = i - i / 5 * 5 - 2;
+        ps[i].bounces = 0;
+    }
+
+    for (t = 0; t < 5000; t = t + 1)
+        for (i = 0; i < n; i = i + 1)
+            step(&ps[i], size);
+
+    long sum = 0;
+    for (i = 0; i < n; i = i + 1)
+        sum = sum + ps[i].x + ps[i].y + ps[i].bounces;
+    printf("%ld\n", sum);
+    return 0;
+}
@@ -8,51 +8,266 @@ static char *argreg8[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};   // 64-bit
 
 static int labelseq = 1;
 static char *funcname;
+static Function *current_fn;
 
 static int cur_line_no = 0;
+static int cur_col_no = 0;
 
-static void println(char *fmt, ...) {
+// Number of 8-byte values pushed to the stack since the prologue.
+// Every statement leaves it unchanged, so its value at each point of
+// the function is known at compile time.
+static int depth;
+static int max_depth;
+
+// Frame layout of the current function
+static bool omit_fp;    // locals are addressed relative to rsp
+static int frame_off;   // offset of the frame base from rsp at depth 0
+static int frame_slots; // 8-byte slots between the return address and rsp at depth 0
+static bool has_call;   // the function is not a leaf
+static int frame_size;  // bytes allocated below the return address
+static bool tail_calls; // calls in tail position may reuse the frame
+
+// Statements that profiling found rarely run. They are emitted after
+// the rest of the function so that the hot code stays together.
+typedef struct ColdBlock ColdBlock;
+struct ColdBlock {
+    ColdBlock *next;
+    Node *stmt;
+    char *label; // start of the block
+    char *end;   // where the block continues
+};
+
+static ColdBlock *cold_blocks;
+
+// Calls made by the function being generated
+static CallSite *call_sites;
+
+static void add_call_site(char *name, int stack_bytes) {
+    CallSite *cs = alloc(MEM_OTHER, sizeof(CallSite));
+    cs->name = name;
+    cs->stack_bytes = stack_bytes;
+    cs->next = call_sites;
+    call_sites = cs;
+}
+
+static char *format(char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
-    vfprintf(output_file, fmt, ap);
-    fprintf(output_file, "\n");
+    char *buf;
+    if(vasprintf(&buf, fmt, ap) < 0)
+        error("out of memory");
+    va_end(ap);
+    mem_account(MEM_OUTPUT, strlen(buf) + 1);
+    return buf;
+}
+
+static void push(char *arg) {
+    println("    push %s", arg);
+    depth++;
+    if(max_depth < depth)
+        max_depth = depth;
+}
+
+static void pop(char *arg) {
+    println("    pop %s", arg);
+    depth--;
+}
+
+// Drops the value on top of the stack.
+static void discard(void) {
+    println("    add rsp, 8");
+    depth--;
 }
 
 static void gen(Node *node);
 
-// ローカル変数のアドレスの取得
-static void gen_addr(Node *node) {
+// Jumps to `label` dropping `n` values pushed since the point the label
+// is placed at. The CFA offset is restored for the code that follows.
+static void jump_out(int n, char *label) {
+    if(n == 0) {
+        println("    jmp %s", label);
+        return;
+    }
+    if(omit_fp)
+        println("    .cfi_remember_state");
+    println("    add rsp, %d", n * 8);
+    println("    jmp %s", label);
+    if(omit_fp)
+        println("    .cfi_restore_state");
+}
+
+// Memory operand of the form [base + index*scale + disp] selected for an
+// lvalue. A local variable is based on the stack frame and a global on
+// its symbol; `base` and `index` are subtrees that have to be evaluated
+// at runtime.
+typedef struct {
+    bool frame;  // base is the stack frame
+    char *sym;   // base is a global symbol
+    Node *base;  // base computed at runtime
+    Node *index; // index computed at runtime
+    int scale;
+    long disp;
+} Addr;
+
+static bool is_scale(int size) {
+    return size == 1 || size == 2 || size == 4 || size == 8;
+}
+
+static bool is_disp32(long val) {
+    return -2147483648L <= val && val <= 2147483647L;
+}
+
+static bool select_addr(Node *node, Addr *a);
+
+// Tiles a pointer-valued expression into an address.
+// e.g. `p + i*4 + 8` => [rax+rdx*4+8] where rax = p and rdx = i
+static void select_ptr(Node *node, Addr *a) {
+    Addr tmp = {};
+
+    // An array or `&x` evaluates to the address of the object itself.
+    if(node->ty->kind == TY_ARRAY && select_addr(node, &tmp)) {
+        *a = tmp;
+        return;
+    }
+    if(node->kind == ND_ADDR && select_addr(node->lhs, &tmp)) {
+        *a = tmp;
+        return;
+    }
+
+    if(node->kind == ND_PTR_ADD || node->kind == ND_PTR_SUB) {
+        int size = node->ty->base->size;
+        int sign = (node->kind == ND_PTR_ADD) ? 1 : -1;
+        Node *idx = node->rhs;
+        long disp = 0;
+
+        // Fold a constant term of the index into the displacement.
+        if((idx->kind == ND_ADD || idx->kind == ND_SUB) && idx->rhs->kind == ND_NUM) {
+            disp = (idx->kind == ND_ADD ? idx->rhs->val : -idx->rhs->val) * size * sign;
+            idx = idx->lhs;
+        }
+
+        select_ptr(node->lhs, &tmp);
+
+        if(idx->kind == ND_NUM) {
+            tmp.disp += disp + idx->val * size * sign;
+            if(is_disp32(tmp.disp)) {
+                *a = tmp;
+                return;
+            }
+        } else if(sign == 1 && !tmp.index && is_scale(size)) {
+            tmp.index = idx;
+            tmp.scale = size;
+            tmp.disp += disp;
+            if(is_disp32(tmp.disp)) {
+                *a = tmp;
+                return;
+            }
+        }
+    }
+
+    *a = (Addr){.base = node};
+}
+
+// Tiles an lvalue into an address. Returns false if `node` has no
+// addressing-mode form, in which case the generic path has to be used.
+static bool select_addr(Node *node, Addr *a) {
     switch(node->kind) {
-    case ND_VAR: {
-        Var *var = node->var;
-        if (var->is_local) {
-            println("#----- Local variable");
-            println("#----- Pushes the given node's memory address to the stack.");
-            // srcオペランドのメモリアドレスを計算し、distオペランドにロードする
-            println("# DEBUG: var->name: %s", var->name);
-            println("    lea rax, [rbp-%d]", var->offset); // lea : load effective address
-            println("    push rax"); // raxの値(ローカル変数のメモリアドレス)をスタックにpushする
-        } else {
+    case ND_VAR:
+        if(node->var->is_local)
+            *a = (Addr){.frame = true, .disp = -node->var->offset};
+        else
+            *a = (Addr){.sym = node->var->name};
+        return true;
+    case ND_DEREF:
+        select_ptr(node->lhs, a);
+        return true;
+    case ND_MEMBER:
+        if(!select_addr(node->lhs, a))
+            return false;
+        a->disp += node->member->offset;
+        return is_disp32(a->disp);
+    }
+    return false;
+}
+
+// Evaluates the runtime parts of an address and pushes them to the stack.
+static void gen_addr_parts(Addr *a) {
+    if(a->base)
+        gen(a->base);
+    if(a->index)
+        gen(a->index);
+}
+
+// Pops the runtime parts of an address into rax (base) and rdx (index)
+// and returns the memory operand. The result is valid until the next call.
+static char *pop_addr(Addr *a) {
+    static char buf[128];
+
+    if(a->index)
+        pop("rdx");
+    if(a->base)
+        pop("rax");
+
+    // Without a frame pointer a local is addressed relative to rsp, which
+    // moves with every value pushed to the stack.
+    long disp = a->disp;
+    int len;
+    if(a->frame && omit_fp) {
+        len = sprintf(buf, "[rsp");
+        disp += depth * 8 + frame_off;
+    } else if(a->frame)
+        len = sprintf(buf, "[rbp");
+    else if(a->base)
+        len = sprintf(buf, "[rax");
+    else if(a->index)
+        len = sprintf(buf, "[%s", a->sym);
+    else
+        len = sprintf(buf, "[rip+%s", a->sym);
+
+    if(a->index)
+        len += sprintf(buf + len, "+rdx*%d", a->scale);
+    if(disp)
+        len += sprintf(buf + len, "%+ld", disp);
+    sprintf(buf + len, "]");
+    return buf;
+}
+
+// Pushes the given node's memory address to the stack.
+static void gen_addr(Node *node) {
+    Addr a;
+    if(select_addr(node, &a)) {
+        if(a.base && !a.index && !a.disp) {
+            gen(a.base);
+            return;
+        }
+        if(a.sym && !a.index) {
             println("#----- Global variable");
-            println("    push offset %s", var->name);
+            if(a.disp)
+                push(format("offset %s%+ld", a.sym, a.disp));
+            else
+                push(format("offset %s", a.sym));
+            return;
         }
+
+        gen_addr_parts(&a);
+        println("    lea rax, %s", pop_addr(&a)); // lea : load effective address
+        push("rax");
         return;
     }
-    case ND_DEREF: // 左辺値に逆参照がきた場合に処理できるようにする
-        gen(node->lhs); // 左辺を展開する
-        return;
+
+    switch(node->kind) {
     case ND_COMMA:
         // TODO: あとで確認する
         println("#----- Comma operator");
         gen(node->lhs);
-        println("    add rsp, 8");
+        discard();
         gen_addr(node->rhs);
         return;
     case ND_MEMBER:
         gen_addr(node->lhs);
-        println("    pop rax");
+        pop("rax");
         println("    add rax, %d", node->member->offset);
-        println("    push rax");
+        push("rax");
         return;
     }
 
@@ -65,6 +280,44 @@ static void gen_lval(Node *node) {
     gen_addr(node);
 }
 
+static char *size_ptr(Type *ty) {
+    if(ty->size == 1)
+        return "byte ptr";
+    if(ty->size == 2)
+        return "word ptr";
+    if(ty->size == 4)
+        return "dword ptr";
+    assert(ty->size == 8);
+    return "qword ptr";
+}
+
+// rdi narrowed to the size of `ty`
+static char *rdi_reg(Type *ty) {
+    if(ty->size == 1)
+        return argreg1[0];
+    if(ty->size == 2)
+        return argreg2[0];
+    if(ty->size == 4)
+        return argreg4[0];
+    assert(ty->size == 8);
+    return argreg8[0];
+}
+
+// Loads a value of type `ty` from the memory operand `addr` to rax.
+static void load_from(Type *ty, char *addr) {
+    if( ty->size == 1 ) {
+        // movsx命令 符号拡張が不要
+        println("    movsx rax, byte ptr %s", addr); // アドレスから1バイトの読みこみ、raxにセット
+    } else if(ty->size == 2) {
+        println("    movsx rax, word ptr %s", addr);
+    } else if(ty->size == 4) {
+        println("    movsxd rax, dword ptr %s", addr);
+    } else {
+        assert(ty->size == 8);
+        println("    mov rax, %s", addr); // メモリアドレスから値をロードしてraxレジスタにコピーする
+    }
+}
+
 static void load(Type *ty) {
     if(ty->kind == TY_ARRAY || ty->kind == TY_STRUCT) {
         // If it is an array, do nothing because in general we can't load 
@@ -79,119 +332,578 @@ static void load(Type *ty) {
     }
 
     println("#----- Load a value from the memory address.");
-    println("    pop rax"); // スタックトップからローカル変数のアドレスをpopしてraxに保存する
-    
-    if( ty->size == 1 ) {
-        // movsx命令 符号拡張が不要
-        println("    movsx rax, byte ptr [rax]"); // raxの指しているアドレスから1バイトの読みこみ、raxにセット
-    } else if(ty->size == 2) {
-        println("    movsx rax, word ptr [rax]");
-    } else if(ty->size == 4) {
-        println("    movsxd rax, dword ptr [rax]");
-    } else {
-        assert(ty->size == 8);
-        println("    mov rax, [rax]"); // raxに入っている値をアドレスとみなして、そのメモリアドレスから値をロードしてraxレジスタにコピーする
+    pop("rax"); // スタックトップからローカル変数のアドレスをpopしてraxに保存する
+    load_from(ty, "[rax]");
+    push("rax"); // raxの値をスタックにpush
+}
+
+// Loads the value of an lvalue, folding its address into the load.
+static void gen_load(Node *node) {
+    Addr a;
+    if(node->ty->kind == TY_ARRAY || node->ty->kind == TY_STRUCT || !select_addr(node, &a)) {
+        gen_addr(node);
+        load(node->ty);
+        return;
     }
 
-    println("    push rax"); // raxの値をスタックにpush
+    println("#----- Load a value from the memory address.");
+    gen_addr_parts(&a);
+    load_from(node->ty, pop_addr(&a));
+    push("rax");
 }
 
-static void store(Type *ty) {
-    println("#----- Store a value to the memory address.");
+// Structs larger than this are copied with `rep movsb`.
+#define INLINE_COPY_MAX 128
+
+// Copies a struct of type `ty` from [rdi] to [rax].
+static void copy_struct(Type *ty) {
+    /*
+        e.g.
+        struct t {int a; int b;} x;
+        struct t y;
+        y = x;
+    */
+    // rdi: 変数xのアドレス(assignする値を持っている)
+    // rax: 変数yのアドレス(assignされる側)
+    int size = ty->size;
+
+    if(size > INLINE_COPY_MAX) {
+        // rep movsb copies rcx bytes from [rsi] to [rdi].
+        println("    mov rdx, rdi");
+        println("    mov rsi, rdi");
+        println("    mov rdi, rax");
+        println("    mov rcx, %d", size);
+        println("    rep movsb");
+        println("    mov rdi, rdx");
+        return;
+    }
 
-    println("    pop rdi"); // スタックトップの値(右辺値)をrdiにロードする
-    println("    pop rax"); // スタックトップの値(アドレス)をraxにロードする
+    // Copy with the widest moves first: 16-byte SSE moves, then 8, 4, 2
+    // and 1-byte moves for the tail.
+    int i = 0;
+    for(; size - i >= 16; i += 16) {
+        println("    movdqu xmm0, [rdi+%d]", i);
+        println("    movdqu [rax+%d], xmm0", i);
+    }
+
+    static char *tmp[] = {"sil", "si", NULL, "esi", NULL, NULL, NULL, "rsi"};
+    for(int w = 8; w >= 1; w /= 2) {
+        for(; size - i >= w; i += w) {
+            println("    mov %s, [rdi+%d]", tmp[w-1], i);
+            println("    mov [rax+%d], %s", i, tmp[w-1]);
+        }
+    }
+}
+
+// Stores rdi to the memory operand `addr` and pushes rdi.
+static void store(Type *ty, char *addr) {
+    println("#----- Store a value to the memory address.");
 
     if(ty->kind == TY_STRUCT) {
-        println("#----- TY_STRUCT\n");
-        // TODO: あとで実装確認
-        for(int i = 0; i < ty->size; i++) {
-            /*
-                e.g.
-                struct t {int a; int b;} x;
-                struct t y;
-                y = x;
-            */
-            // rdi: 変数xのアドレス(assignする値を持っている)
-            // rax: 変数yのアドレス(assignされる側)
-            // 1バイトずつ値をコピー?
-            println("    movsx rsi, byte ptr [rdi+%d]", i);
-            println("    mov [rax+%d], sil", i);
+        println("#----- TY_STRUCT");
+        if(strcmp(addr, "[rax]"))
+            println("    lea rax, %s", addr);
+        copy_struct(ty);
+    } else {
+        // raxに入っている値をアドレスとみなし、そのメモリアドレスにrdiに入っている値をストア
+        println("    mov %s, %s", addr, rdi_reg(ty));
+    }
+
+    push("rdi"); // rdiの値をスタックにpush
+}
+
+// Returns true if `val` can be the immediate of an operation of `size`
+// bytes.
+static bool fits_size(long val, int size) {
+    if(size == 1)
+        return -128 <= val && val <= 127;
+    if(size == 2)
+        return -32768 <= val && val <= 32767;
+    return is_disp32(val);
+}
+
+// Lowers `x = x + y` and `x = x - y` to a read-modify-write instruction
+// on x's memory operand. Returns false if the pattern does not match.
+static bool gen_rmw(Node *node) {
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+    Type *ty = lhs->ty;
+    Addr a;
+
+    if(rhs->kind != ND_ADD && rhs->kind != ND_SUB &&
+       rhs->kind != ND_PTR_ADD && rhs->kind != ND_PTR_SUB)
+        return false;
+    if(!is_integer(ty) && ty->kind != TY_PTR)
+        return false;
+    if(!is_pure(lhs) || !is_pure(rhs->rhs) || !same_expr(lhs, rhs->lhs))
+        return false;
+    if(!select_addr(lhs, &a))
+        return false;
+
+    char *op = (rhs->kind == ND_ADD || rhs->kind == ND_PTR_ADD) ? "add" : "sub";
+    int scale = (rhs->kind == ND_PTR_ADD || rhs->kind == ND_PTR_SUB) ? rhs->ty->base->size : 1;
+    char *addr;
+
+    println("#----- Read-modify-write");
+    gen_addr_parts(&a);
+    if(rhs->rhs->kind == ND_NUM && fits_size(rhs->rhs->val * scale, ty->size)) {
+        addr = pop_addr(&a);
+        println("    %s %s %s, %ld", op, size_ptr(ty), addr, rhs->rhs->val * scale);
+    } else {
+        gen(rhs->rhs);
+        pop("rdi");
+        if(scale != 1)
+            println("    imul rdi, %d", scale);
+        addr = pop_addr(&a);
+        println("    %s %s, %s", op, addr, rdi_reg(ty));
+    }
+
+    // The value of an assignment is the new value of the lvalue.
+    load_from(ty, addr);
+    push("rax");
+    return true;
+}
+
+static bool is_cmp(Node *node) {
+    return node->kind == ND_EQ || node->kind == ND_NE ||
+           node->kind == ND_LT || node->kind == ND_LE;
+}
+
+// Condition code suffix of a comparison node.
+static char *cond_code(NodeKind kind, bool swapped) {
+    switch(kind) {
+    case ND_EQ: return "e";
+    case ND_NE: return "ne";
+    case ND_LT: return swapped ? "g" : "l";
+    case ND_LE: return swapped ? "ge" : "le";
+    }
+    error("not a comparison");
+}
+
+static char *invert_cond(char *cc) {
+    static char *pairs[][2] = {
+        {"e", "ne"}, {"l", "ge"}, {"le", "g"},
+    };
+    for(int i = 0; i < sizeof(pairs) / sizeof(*pairs); i++) {
+        if(!strcmp(cc, pairs[i][0]))
+            return pairs[i][1];
+        if(!strcmp(cc, pairs[i][1]))
+            return pairs[i][0];
+    }
+    error("unknown condition code: %s", cc);
+}
+
+// Emits a `cmp` for a comparison node without materializing its 0/1
+// result, and returns the condition code under which it holds.
+// A constant operand becomes an immediate and a scalar lvalue compared
+// against an immediate is compared in memory.
+static char *gen_cmp(Node *node) {
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+    bool swapped = false;
+
+    if(lhs->kind == ND_NUM && rhs->kind != ND_NUM) {
+        Node *tmp = lhs;
+        lhs = rhs;
+        rhs = tmp;
+        swapped = true;
+    }
+
+    if(rhs->kind == ND_NUM && is_disp32(rhs->val)) {
+        Addr a;
+        if((lhs->kind == ND_VAR || lhs->kind == ND_MEMBER || lhs->kind == ND_DEREF) &&
+           (is_integer(lhs->ty) || lhs->ty->kind == TY_PTR) &&
+           fits_size(rhs->val, lhs->ty->size) && select_addr(lhs, &a)) {
+            gen_addr_parts(&a);
+            println("    cmp %s %s, %ld", size_ptr(lhs->ty), pop_addr(&a), rhs->val);
+        } else {
+            gen(lhs);
+            pop("rax");
+            println("    cmp rax, %ld", rhs->val);
+        }
+        return cond_code(node->kind, swapped);
+    }
+
+    gen(lhs);
+    gen(rhs);
+    pop("rdi");
+    pop("rax");
+    println("    cmp rax, rdi");
+    return cond_code(node->kind, swapped);
+}
+
+// Emits code that jumps to `label` if `node` evaluates to `jump_if`
+// and falls through otherwise. Comparisons become a single cmp and a
+// conditional jump, and &&, || and ! become chains of branches.
+static void gen_branch(Node *node, bool jump_if, char *label) {
+    switch(node->kind) {
+    case ND_NUM:
+        if((node->val != 0) == jump_if)
+            println("    jmp %s", label);
+        return;
+    case ND_NOT:
+        gen_branch(node->lhs, !jump_if, label);
+        return;
+    case ND_LOGAND:
+    case ND_LOGOR: {
+        // a && b jumps if false as soon as a is false, and
+        // a || b jumps if true as soon as a is true.
+        bool shortcut = (node->kind == ND_LOGOR);
+        if(jump_if == shortcut) {
+            gen_branch(node->lhs, jump_if, label);
+            gen_branch(node->rhs, jump_if, label);
+            return;
         }
+        char *skip = format(".L.skip.%d", labelseq++);
+        gen_branch(node->lhs, shortcut, skip);
+        gen_branch(node->rhs, jump_if, label);
+        println("%s:", skip);
+        return;
+    }
+    }
+
+    if(is_cmp(node)) {
+        char *cc = gen_cmp(node);
+        println("    j%s %s", jump_if ? cc : invert_cond(cc), label);
+        return;
+    }
+
+    gen(node);
+    pop("rax");
+    println("    test rax, rax");
+    println("    j%s %s", jump_if ? "ne" : "e", label);
+}
+
+// Increments profile counter `k` of `node`.
+static void gen_counter(Node *node, int k) {
+    if(opt_profile_generate && node->prof_id)
+        println("    add qword ptr [rip+.L.prof.counts+%d], 1", (node->prof_id - 1 + k) * 8);
+}
+
+static void load_arg(Var *var, int idx);
+
+static int count_args(Node *node) {
+    int n = 0;
+    for(Node *arg = node->args; arg; arg = arg->next)
+        n++;
+    return n;
+}
 
-        // TODO: この部分必要かどうかあとで検討
-        println("    push rsi");
-        println("    add rsp, 8");
-    } else if ( ty->size == 1 ) {
-        println("    mov [rax], dil"); // 1バイトの書き出し
-    } else if ( ty->size == 2 ){
-        println("    mov [rax], di");
-    } else if ( ty->size == 4 ){
-        println("    mov [rax], edi"); // 4バイトの書き出し
+static int count_params(Function *fn) {
+    int n = 0;
+    for(VarList *vl = fn->params; vl; vl = vl->next)
+        n++;
+    return n;
+}
+
+// Returns true if `node` is a "return" of a call whose result is
+// returned as is, so that the call can reuse the current frame.
+static bool is_tail_call(Node *node) {
+    return tail_calls && !node->target && node->lhs->kind == ND_FUNCALL;
+}
+
+static bool is_self_call(Node *node) {
+    return !strcmp(node->funcname, funcname) &&
+           count_args(node) == count_params(current_fn);
+}
+
+// Emits `return f(...)` as a jump. A call to the function itself stores
+// the arguments to the parameters and jumps back to the start of the
+// body; any other call tears down the frame first, so that the callee
+// returns directly to our caller.
+static void gen_tail_call(Node *node) {
+    println("#----- Tail call");
+    // The callee replaces the frame of this function.
+    if(!is_self_call(node))
+        add_call_site(node->funcname, 0);
+    gen_counter(node, 0);
+    int nargs = 0;
+    for(Node *arg = node->args; arg; arg = arg->next) {
+        gen(arg);
+        nargs++;
+    }
+    for(int i = nargs-1; i >= 0; i--)
+        pop(argreg8[i]);
+
+    if(is_self_call(node)) {
+        int i = 0;
+        for(VarList *vl = current_fn->params; vl; vl = vl->next)
+            load_arg(vl->var, i++);
+        jump_out(depth, format(".L.body.%s", funcname));
+        return;
+    }
+
+    println("    mov rax, 0");
+    if(omit_fp) {
+        jump_out(depth + frame_size / 8, node->funcname);
+        return;
+    }
+    println("    .cfi_remember_state");
+    println("    mov rsp, rbp");
+    println("    .cfi_def_cfa rsp, 16");
+    println("    pop rbp");
+    println("    .cfi_restore rbp");
+    println("    jmp %s", node->funcname);
+    println("    .cfi_restore_state");
+}
+
+// Aligns a loop header to 16 bytes unless that takes more than 10
+// bytes of padding. A loop that the profile says never iterates is
+// not worth the padding.
+static void align_loop(Node *node) {
+    if(opt_align_loops && profile_count(node, 1) != 0)
+        println("    .p2align 4,,10");
+}
+
+static void add_cold_block(Node *stmt, char *label, char *end) {
+    ColdBlock *cb = alloc(MEM_OTHER, sizeof(ColdBlock));
+    cb->stmt = stmt;
+    cb->label = label;
+    cb->end = end;
+    cb->next = cold_blocks;
+    cold_blocks = cb;
+}
+
+// Stores register `reg` to the variable `node`.
+static void store_var(Node *node, char *reg) {
+    Addr a;
+    select_addr(node, &a);
+    gen_addr_parts(&a);
+    println("    mov rdi, %s", reg);
+    store(node->ty, pop_addr(&a));
+    discard();
+}
+
+// Sign-extends the 16 chars in `reg` to ints and adds them to xmm2.
+static void add_chars_to_sum(char *reg) {
+    println("    movdqa xmm3, %s", reg);
+    println("    punpcklbw xmm3, xmm3");
+    println("    psraw xmm3, 8");
+    println("    punpckhbw %s, %s", reg, reg);
+    println("    psraw %s, 8", reg);
+
+    char *words[] = {"xmm3", reg};
+    for(int i = 0; i < 2; i++) {
+        println("    movdqa xmm4, %s", words[i]);
+        println("    punpcklwd xmm4, xmm4");
+        println("    psrad xmm4, 16");
+        println("    paddd xmm2, xmm4");
+        println("    punpckhwd %s, %s", words[i], words[i]);
+        println("    psrad %s, 16", words[i]);
+        println("    paddd xmm2, %s", words[i]);
+    }
+}
+
+// Runs the iterations of a vectorized loop that fill whole 16-byte
+// vectors and leaves the induction variable at the first one left.
+//
+//   rsi: src1, rdx: src2, rdi: dst, rcx: iv, r8: limit
+//   xmm1: scalar broadcast to every lane, xmm2: partial sums
+static void gen_vector(Node *node) {
+    Vector *vec = node->vec;
+    int seq = labelseq++;
+    int size = vec->ty->size;
+    int lanes = 16 / size;
+    char *sfx = (size == 1) ? "b" : "d";
+    char *end = format(".L.vec.end.%d", seq);
+
+    println("#----- Vectorized loop");
+    gen(vec->limit);
+    gen(vec->iv);
+    if(vec->dst)
+        gen(vec->dst);
+    if(vec->src2)
+        gen(vec->src2);
+    gen(vec->src1);
+    if(vec->scalar)
+        gen(vec->scalar);
+
+    if(vec->scalar)
+        pop("rax");
+    pop("rsi");
+    if(vec->src2)
+        pop("rdx");
+    if(vec->dst)
+        pop("rdi");
+    pop("rcx");
+    pop("r8");
+    if(vec->inclusive)
+        println("    add r8, 1");
+
+    if(vec->sum)
+        println("    pxor xmm2, xmm2");
+    if(vec->scalar) {
+        println("    movd xmm1, eax");
+        if(size == 1) {
+            println("    punpcklbw xmm1, xmm1");
+            println("    punpcklwd xmm1, xmm1");
+        }
+        println("    pshufd xmm1, xmm1, 0");
+    }
+
+    // A store into the 16 bytes just past a load would be seen by the
+    // next scalar iteration but not by the vector.
+    char *srcs[] = {"rsi", "rdx"};
+    bool checks[] = {vec->check_src1, vec->check_src2};
+    for(int i = 0; i < 2; i++) {
+        if(!checks[i])
+            continue;
+        println("    mov rax, rdi");
+        println("    sub rax, %s", srcs[i]);
+        println("    sub rax, 1");
+        println("    cmp rax, 15");
+        println("    jb %s", end);
+    }
+
+    align_loop(node);
+    println(".L.vec.begin.%d:", seq);
+    println("    lea rax, [rcx+%d]", lanes);
+    println("    cmp rax, r8");
+    println("    jg %s", end);
+    println("    movdqu xmm0, [rsi+rcx*%d]", size);
+
+    if(vec->sum) {
+        if(size == 1)
+            add_chars_to_sum("xmm0");
+        else
+            println("    paddd xmm2, xmm0");
     } else {
-        assert(ty->size == 8);
-        println("    mov [rax], rdi"); // raxに入っている値をアドレスとみなし、そのメモリアドレスにrdiに入っている値をストア
+        char *op = (vec->op == ND_ADD) ? "padd" : "psub";
+        if(vec->src2) {
+            println("    movdqu xmm3, [rdx+rcx*%d]", size);
+            println("    %s%s xmm0, xmm3", op, sfx);
+        } else if(vec->scalar) {
+            println("    %s%s xmm0, xmm1", op, sfx);
+        }
+        println("    movdqu [rdi+rcx*%d], xmm0", size);
     }
 
-    println("    push rdi"); // rdiの値をスタックにpush
+    println("    mov rcx, rax");
+    println("    jmp .L.vec.begin.%d", seq);
+    println("%s:", end);
+
+    store_var(vec->iv, "rcx");
+    if(vec->sum) {
+        println("    pshufd xmm0, xmm2, 0x4e");
+        println("    paddd xmm2, xmm0");
+        println("    pshufd xmm0, xmm2, 0xb1");
+        println("    paddd xmm2, xmm0");
+        println("    movd ecx, xmm2");
+        gen(vec->sum);
+        pop("rdi");
+        println("    add ecx, edi");
+        println("    movsxd rcx, ecx");
+        store_var(vec->sum, "rcx");
+    }
 }
 
 // 抽象構文木からアセンブリコードを生成する
 static void gen(Node *node) {
-    if (node->tok->line_no != cur_line_no) {
-        println("    .loc 1 %d", node->tok->line_no);
+    if (node->tok->line_no != cur_line_no || node->tok->col_no != cur_col_no) {
+        println("    .loc 1 %d %d", node->tok->line_no, node->tok->col_no);
         cur_line_no = node->tok->line_no;
+        cur_col_no = node->tok->col_no;
     }
 
     switch(node->kind) {
     case ND_NULL: // Empty statement
         return;
     case ND_NUM:
-        println("    push %ld", node->val);
+        push(format("%ld", node->val));
         return;
     case ND_EXPR_STMT:
         // expression (式):  値を一つ必ず残す
         // statement (文):  値を必ず何も残さない
         println("#----- Expression statement");
         gen(node->lhs);
-        println("    add rsp, 8");
+        discard();
         return;
     case ND_VAR: // 変数の値の参照
     case ND_MEMBER: // structのmemberへのアクセス
-        gen_addr(node);
-
-        load(node->ty); // メモリアドレスからデータをレジスタにload
+    case ND_DEREF:
+        gen_load(node); // メモリアドレスからデータをレジスタにload
         return;
-    case ND_ASSIGN: // ローカル変数(左辺値)への値(右辺値)の割り当て
+    case ND_ASSIGN: { // ローカル変数(左辺値)への値(右辺値)の割り当て
         // gen_lvalでTY_ARRAYの場合はエラーを出力
         // 左辺のkindがTY_ARRAYではない場合のみ、左辺値として処理できる(arrayの形のままではどのアドレスに値を割り当てるかわからない)
+        if(node->lhs->ty->kind == TY_ARRAY)
+            error_tok(node->lhs->tok, "not an lvalue");
+        if(gen_rmw(node))
+            return;
+
+        Addr a;
+        if(select_addr(node->lhs, &a)) {
+            gen_addr_parts(&a);
+            gen(node->rhs);
+            pop("rdi"); // スタックトップの値(右辺値)をrdiにロードする
+            store(node->ty, pop_addr(&a));
+            return;
+        }
+
         gen_lval(node->lhs); // =>最終的に計算結果を入れたraxの値(アドレス)がスタックにpushされる ...push rax
         gen(node->rhs); // =>最終的に計算結果を入れたraxの値(右辺値)がスタックにpushされる ...push rax
 
         // メモリアドレスへのデータのstore
-        store(node->ty);
+        pop("rdi"); // スタックトップの値(右辺値)をrdiにロードする
+        pop("rax"); // スタックトップの値(アドレス)をraxにロードする
+        store(node->ty, "[rax]");
         return;
+    }
     case ND_IF: {
         int seq = labelseq++;
+        char *end = format(".L.end.%d", seq);
+        long total = profile_count(node, 0);
+        long taken = profile_count(node, 1);
+        long not_taken = (total < 0) ? -1 : total - taken;
 
         println("#----- \"If\" statement");
+        gen_counter(node, 0);
+
+        // A rarely taken branch is moved to the end of the function.
+        // Only statements at depth 0 are moved, where the stack there
+        // is the same.
+        if(depth == 0 && is_cold(taken, total)) {
+            char *cold = format(".L.cold.%d", seq);
+            gen_branch(node->cond, true, cold);
+            if(node->els)
+                gen(node->els);
+            println("%s:", end);
+            add_cold_block(node->then, cold, end);
+            return;
+        }
+        if(depth == 0 && node->els && is_cold(not_taken, total)) {
+            char *cold = format(".L.cold.%d", seq);
+            gen_branch(node->cond, false, cold);
+            gen(node->then);
+            println("%s:", end);
+            add_cold_block(node->els, cold, end);
+            return;
+        }
+
+        // Otherwise the more common branch falls through.
+        if(node->els && not_taken > taken) {
+            gen_branch(node->cond, true, format(".L.then.%d", seq));
+            gen(node->els);
+            println("    jmp %s", end);
+            println(".L.then.%d:", seq);
+            gen(node->then);
+            println("%s:", end);
+            return;
+        }
+
         if(node->els) {
-            gen(node->cond); // expr Aをコンパイルしたコード スタックトップに値が積まれているはず
-            println("    pop rax");
-            println("    cmp rax, 0");
-            println("    je  .L.else.%d", seq);
+            gen_branch(node->cond, false, format(".L.else.%d", seq)); // expr Aをコンパイルしたコード
+            gen_counter(node, 1);
             gen(node->then); // stmt
-            println("    jmp .L.end.%d", seq);
+            println("    jmp %s", end);
             println(".L.else.%d:", seq);
             gen(node->els);  // stmt
-            println(".L.end.%d:", seq);
+            println("%s:", end);
         } else {
-            gen(node->cond); // expr Aをコンパイルしたコード スタックトップに値が積まれているはず
-            println("    pop rax");
-            println("    cmp rax, 0");
-            println("    je  .L.end.%d", seq);
+            gen_branch(node->cond, false, end); // expr Aをコンパイルしたコード
+            gen_counter(node, 1);
             gen(node->then); // stmt
-            println(".L.end.%d:", seq);
+            println("%s:", end);
         }
         return;
     }
@@ -202,14 +914,17 @@ static void gen(Node *node) {
             A: expression
             B: statement
         */
+        // The loop is rotated so that each iteration takes a single
+        // conditional branch at the bottom; A is also checked once
+        // before entering the loop.
         println("#----- \"While\" statement");
+        gen_counter(node, 0);
+        gen_branch(node->cond, false, format(".L.end.%d", seq)); // Aをコンパイルしたコード
+        align_loop(node);
         println(".L.begin.%d:", seq);
-        gen(node->cond);    // Aをコンパイルしたコード
-        println("    pop rax");
-        println("    cmp rax, 0");
-        println("    je  .L.end.%d", seq);
+        gen_counter(node, 1);
         gen(node->then);    // Bをコンパイルしたコード
-        println("    jmp .L.begin.%d", seq);
+        gen_branch(node->cond, true, format(".L.begin.%d", seq));
         println(".L.end.%d:", seq);
         return;
     }
@@ -225,25 +940,44 @@ static void gen(Node *node) {
             C: increment   expression statement
             D:             statement
         */
+        // Rotated like "while".
         println("#----- \"For\" statement");
+        gen_counter(node, 0);
         if(node->init)
             gen(node->init); // the code which compiled A
+        if(node->vec)
+            gen_vector(node);
+        if(node->cond)
+            gen_branch(node->cond, false, format(".L.end.%d", seq)); // the code which compiled B
+        align_loop(node);
         println(".L.begin.%d:", seq);
-        if(node->cond) {
-            gen(node->cond); // the code which compiled B
-            println("    pop rax");
-            println("    cmp rax, 0");
-            println("    je  .L.end.%d", seq);
-        }
+        gen_counter(node, 1);
         gen(node->then); // the code which compiled D
         if(node->inc)
             gen(node->inc);  // the code which compiled C
-        println("    jmp .L.begin.%d", seq);
+        if(node->cond)
+            gen_branch(node->cond, true, format(".L.begin.%d", seq));
+        else
+            println("    jmp .L.begin.%d", seq);
         println(".L.end.%d:", seq);
         return;
     }
-    case ND_BLOCK:
-    case ND_STMT_EXPR: {
+    case ND_STMT_EXPR:
+        if(node->inlined) {
+            // Inlined function call. Its body consists of statements only
+            // and every "return" in it leaves the value in rax.
+            node->end_seq = labelseq++;
+            node->end_depth = depth;
+            println("#----- Inlined call to %s", node->inlined->name);
+            gen_counter(node, 0);
+            for(Node *n = node->body; n; n = n->next)
+                gen(n);
+            println(".L.inline.end.%d:", node->end_seq);
+            push("rax");
+            return;
+        }
+        // fallthrough
+    case ND_BLOCK: {
         if(node->body) {
             Node *n = node->body; // statementのリストの先頭
             println("#----- Block {...} or Statement expression");
@@ -258,11 +992,12 @@ static void gen(Node *node) {
         // TODO: あとで確認
         println("#----- Comma operator. ");
         gen(node->lhs);
-        println("    add rsp, 8"); // 最後の式の結果以外を捨てる
+        discard(); // 最後の式の結果以外を捨てる
         gen(node->rhs);
         return;
     case ND_FUNCALL: { // 関数呼び出し
         println("#----- Function call with up to 6 parameters. ");
+        gen_counter(node, 0);
         int nargs = 0;
         for (Node *arg = node->args; arg; arg = arg->next) {
             gen(arg);
@@ -281,81 +1016,99 @@ static void gen(Node *node) {
         // 引数の数分、値をpopしてレジスタにセットする
         println("#-- 引数をレジスタにセット ");
         for(int i = nargs-1; i >= 0; i--)
-            println("    pop %s", argreg8[i]);
+            pop(argreg8[i]);
 
         // 関数を呼ぶ前にRSPを調整して、RSPを16byte境界(16の倍数)になるようにアラインメントする
         // - push/popは8byte単位で変更するので、
         //   call命令を発行する時に必ずしもRSPが16の倍数になっているとは限らない
         // - ABI(System V)で決められている
         // - RAXは可変関数のために0にセットされている
-        /*
-            and: (論理積, AND, &) ビットを反転したい箇所に0を置く
-            ・rax = 16の場合
-            15 : 01111
-            16 : 10000
-                 00000 => 0
-            1 => 1
-            2 => 2
-            3 => 3
-            ...
-            14 => 14
-            15 => 15
-            16 => 0
-            17 => 1
-            18 => 2
-            ...
-            31 => 15
-            32 => 0
-            33 => 1
-            ...
-        */
-        int seq = labelseq++;
-        println("    mov rax, rsp");   // rspの値をraxにコピーする
-        println("#-- スタックフレームが16の倍数になっているかどうかチェック");
-        println("    and rax, 15");    // and: 論理積
-        println("#-- もし16の倍数でないならアライン操作するラベルにジャンプ");
-        println("    jnz .L.call.%d", seq);  // 結果が0でない(16の倍数でない)=>RSPのアラインメント操作が必要=>.L.call.XXXラベルへジャンプ
-        println("    mov rax, 0");     // raxに0をコピー
+        // RSP is 16-byte aligned right after the prologue and the number of
+        // values pushed since then is known here, so the adjustment is
+        // decided at compile time.
+        // The return address, the frame and the pushed values all occupy
+        // 8-byte slots; an odd number of them leaves rsp misaligned.
+        bool misaligned = (1 + frame_slots + depth) % 2;
+        has_call = true;
+        add_call_site(node->funcname, 8 * (1 + frame_slots + depth + misaligned));
+        if(misaligned)
+            println("    sub rsp, 8");     // スタックをひとつ増やす(8byte増やすことでRSPを16の倍数に調整)
+        println("    mov rax, 0");         // raxに0をコピー
         println("    call %s", node->funcname);  // 関数呼び出し
-        println("#-- 関数の実行終了のラベルにジャンプ");
-        println("    jmp .L.end.%d", seq);  // 関数呼び出しの結果がraxにセットされている=>.L.end.XXXラベルにジャンプ
-        
-        println("#----- スタックフレームを16の倍数にアラインする");
-        println(".L.call.%d:", seq);   // RSPのアラインメント操作をする
-        println("#-- スタックフレームを8増やす");
-        println("    sub rsp, 8");     // スタックをひとつ増やす(push/popで8byteごとに操作しているので、8byte増やすことでRSPを16の倍数に調整)
-        println("    mov rax, 0");     // raxの値を0にセットする
-        println("    call %s", node->funcname);  // 関数呼び出し (RSPがアラインメントできたのでRSPが呼び出せる)
-        println("#-- アラインのために8増やしたスタックを減らして元に戻す");
-        println("    add rsp, 8");     // スタックをひとつ減らす(RSP調整のために足したスタックを引いておく)
-        
-        println("#----- 関数の実行終了");
-        println(".L.end.%d:", seq);    // 終了処理
-        println("    push rax");       // raxの値(関数呼び出しの結果)をスタックにプッシュ
+        if(misaligned)
+            println("    add rsp, 8");     // スタックをひとつ減らす(RSP調整のために足したスタックを引いておく)
+        push("rax");       // raxの値(関数呼び出しの結果)をスタックにプッシュ
         return;
     }
     case ND_RETURN:
+        if(is_tail_call(node)) {
+            gen_tail_call(node->lhs);
+            return;
+        }
         gen(node->lhs); // returnの返り値になっている式のコードが出力される
 
         // 関数呼び出し元に戻る
         println("#----- Returns to the caller address.");
-        println("    pop rax"); // スタックトップから値をpopしてraxにセットする
+        pop("rax"); // スタックトップから値をpopしてraxにセットする
+        if(node->target) {
+            // Return from an inlined function to the end of the call.
+            jump_out(depth - node->target->end_depth, format(".L.inline.end.%d", node->target->end_seq));
+            return;
+        }
+        if(omit_fp) {
+            // 式の途中からのreturn: エピローグはrspが積まれた値の分だけ
+            // ずれていないことを前提にしているので、先に捨てておく
+            jump_out(depth, format(".L.return.%s", funcname));
+            return;
+        }
         println("    jmp .L.return.%s", funcname); // .L.returnラベルにジャンプ
         return;
     case ND_ADDR:
         gen_addr(node->lhs);
         return;
-    case ND_DEREF:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        // setcc: 条件が成立していれば1、そうでなければ0をalにセットする
+        // movzb: rax全体を0か1にするために上位56ビットをゼロクリアする
+        println("    set%s al", gen_cmp(node));
+        println("    movzb rax, al");
+        push("rax");
+        return;
+    case ND_NOT:
         gen(node->lhs);
-        load(node->ty);
+        pop("rax");
+        println("    test rax, rax");
+        println("    sete al");
+        println("    movzb rax, al");
+        push("rax");
+        return;
+    case ND_LOGAND:
+    case ND_LOGOR: {
+        int seq = labelseq++;
+        gen_branch(node, false, format(".L.false.%d", seq));
+        // Only one of the two values is pushed at runtime, so the CFA
+        // offset after the first is dropped for the second.
+        if(omit_fp)
+            println("    .cfi_remember_state");
+        push("1");
+        println("    jmp .L.end.%d", seq);
+        if(omit_fp)
+            println("    .cfi_restore_state");
+        println(".L.false.%d:", seq);
+        depth--;
+        push("0");
+        println(".L.end.%d:", seq);
         return;
     }
+    }
 
     gen(node->lhs);
     gen(node->rhs);
 
-    println("    pop rdi");
-    println("    pop rax");
+    pop("rdi");
+    pop("rax");
 
     switch(node->kind) {
     case ND_ADD:
@@ -400,107 +1153,585 @@ static void gen(Node *node) {
         // idiv: 符号あり除算命令
         println("    idiv rax, rdi");
         break;
-    case ND_EQ:
-        // popしてきた値をcompareする
-        println("    cmp rax, rdi");
-        // alはraxの下位8ビット
-        println("    sete al");
-        // movzb: rax全体を0か1にするために上位56ビットをゼロクリアする
-        println("    movzb rax, al");
-        break;
-    case ND_NE:
-        println("    cmp rax, rdi");
-        println("    setne al");
-        println("    movzb rax, al");
-        break;
-    case ND_LT:
-        println("    cmp rax, rdi");
-        println("    setl al");
-        println("    movzb rax, al");
-        break;
-    case ND_LE:
-        println("    cmp rax, rdi");
-        println("    setle al");
-        println("    movzb rax, al");
-        break;
     }
 
-    println("    push rax");
+    push("rax");
+}
+
+// Emits `len` bytes of a string as .ascii chunks. If `terminated` is
+// true, the last chunk is a .string which supplies the trailing '\0'.
+static void emit_string_bytes(char *s, int len, bool terminated) {
+    char buf[64 * 4 + 1];
+
+    for(int i = 0; i < len || (terminated && i == 0);) {
+        int n = 0;
+        int end = (len - i < 64) ? len : i + 64;
+        for(; i < end; i++) {
+            unsigned char c = s[i];
+            if(c == '"' || c == '\\' || c < 32 || c >= 127)
+                n += sprintf(buf + n, "\\%03o", c);
+            else
+                buf[n++] = c;
+        }
+        buf[n] = '\0';
+
+        bool last = (i == len);
+        println("    %s \"%s\"", (last && terminated) ? ".string" : ".ascii", buf);
+        if(last)
+            break;
+    }
+}
+
+// Compares string literals by their contents read backwards, so that a
+// literal sorts right before the literals it is a suffix of.
+static int cmp_reversed(const void *x, const void *y) {
+    Var *a = *(Var **)x;
+    Var *b = *(Var **)y;
+    int i = a->cont_len - 2;
+    int j = b->cont_len - 2;
+
+    for(; i >= 0 && j >= 0; i--, j--)
+        if(a->contents[i] != b->contents[j])
+            return (unsigned char)a->contents[i] - (unsigned char)b->contents[j];
+    return (i < 0) ? ((j < 0) ? 0 : -1) : 1;
+}
+
+static bool is_suffix(Var *a, Var *b) {
+    int len = a->cont_len - 1;
+    return len <= b->cont_len - 1 &&
+           !memcmp(a->contents, b->contents + b->cont_len - 1 - len, len);
 }
 
 // リテラルの文字列はスタック上に存在している値ではなく、メモリ上の固定の位置に存在している
 // なので、文字列リテラルを表すためにはグローバル変数を使用する
-static void emit_data(Program *prog) {
-    println(".data");
+// String literals are read-only. Those without an embedded '\0' go to a
+// mergeable string section, where a literal that is a suffix of another
+// one is emitted as an alias into the longer literal, and the linker
+// merges identical strings across object files.
+static void emit_strings(Program *prog) {
+    int n = 0;
+    for(VarList *vl = prog->globals; vl; vl = vl->next)
+        if(vl->var->contents)
+            n++;
+    if(n == 0)
+        return;
 
+    Var **strs = alloc(MEM_OTHER, n * sizeof(Var *));
+    int nmerge = 0;
+    int nplain = n;
     for(VarList *vl = prog->globals; vl; vl = vl->next) {
         Var *var = vl->var;
-        println("%s:", var->name);
-
-        // global変数の場合
-        if (!var->contents) {
-            println("    .zero %d", var->ty->size);
+        if(!var->contents)
             continue;
+        if(memchr(var->contents, '\0', var->cont_len - 1))
+            strs[--nplain] = var;
+        else
+            strs[nmerge++] = var;
+    }
+
+    if(nmerge > 0) {
+        println(".section .rodata.str1.1,\"aMS\",@progbits,1");
+        qsort(strs, nmerge, sizeof(Var *), cmp_reversed);
+
+        // Walk from the longest literal of each suffix chain downwards.
+        Var *root = NULL;
+        for(int i = nmerge - 1; i >= 0; i--) {
+            Var *var = strs[i];
+            if(root && is_suffix(var, root)) {
+                println(".set %s, %s+%d", var->name, root->name, root->cont_len - var->cont_len);
+                continue;
+            }
+            root = var;
+            println("%s:", var->name);
+            emit_string_bytes(var->contents, var->cont_len - 1, true);
         }
+    }
 
-        // 文字列リテラルの場合
-        for( int i = 0; i < var->cont_len; i++ ) {
-            println("    .byte %d", var->contents[i]);
+    if(nplain < n) {
+        println(".section .rodata");
+        for(int i = nplain; i < n; i++) {
+            println("%s:", strs[i]->name);
+            emit_string_bytes(strs[i]->contents, strs[i]->cont_len, false);
         }
     }
 }
 
+static int global_align(Var *var) {
+    // The x86-64 psABI requires global arrays of 16 bytes or more to be
+    // 16-byte aligned.
+    if(var->ty->kind == TY_ARRAY && var->ty->size >= 16 && var->ty->align < 16)
+        return 16;
+    return var->ty->align;
+}
+
+// Orders globals by decreasing alignment so that no padding is needed
+// between them, and small objects before large ones so that scalars
+// share cache lines.
+static int cmp_layout(const void *x, const void *y) {
+    Var *a = *(Var **)x;
+    Var *b = *(Var **)y;
+    if(global_align(a) != global_align(b))
+        return global_align(b) - global_align(a);
+    if(a->ty->size != b->ty->size)
+        return a->ty->size - b->ty->size;
+    return strcmp(a->name, b->name);
+}
+
+// Global variables have no initializers, so they all live in .bss.
+static void emit_data(Program *prog) {
+    int n = 0;
+    for(VarList *vl = prog->globals; vl; vl = vl->next)
+        if(!vl->var->contents)
+            n++;
+
+    // `globals` is in reverse declaration order.
+    Var **vars = alloc(MEM_OTHER, n * sizeof(Var *));
+    int i = n;
+    for(VarList *vl = prog->globals; vl; vl = vl->next)
+        if(!vl->var->contents)
+            vars[--i] = vl->var;
+
+    if(opt_sort_globals)
+        qsort(vars, n, sizeof(Var *), cmp_layout);
+
+    if(n > 0)
+        println(".bss");
+    for(i = 0; i < n; i++) {
+        Var *var = vars[i];
+        // global変数の場合
+        if(global_align(var) > 1)
+            println(".align %d", global_align(var));
+        println(".type %s, @object", var->name);
+        println(".size %s, %d", var->name, var->ty->size);
+        println("%s:", var->name);
+        println("    .zero %d", var->ty->size);
+    }
+
+    emit_strings(prog);
+}
+
 static void load_arg(Var *var, int idx) {
+    Addr a = {.frame = true, .disp = -var->offset};
+    char *addr = pop_addr(&a);
     int sz = var->ty->size;
     if(sz == 1) {
-        println("    mov [rbp-%d], %s", var->offset, argreg1[idx]);
+        println("    mov %s, %s", addr, argreg1[idx]);
     } else if(sz == 2) {
-         println("    mov [rbp-%d], %s", var->offset, argreg2[idx]);
+        println("    mov %s, %s", addr, argreg2[idx]);
     } else if(sz == 4) {
-        println("    mov [rbp-%d], %s", var->offset, argreg4[idx]);
+        println("    mov %s, %s", addr, argreg4[idx]);
     } else {
         assert(sz == 8);
-        println("    mov [rbp-%d], %s", var->offset, argreg8[idx]);
+        println("    mov %s, %s", addr, argreg8[idx]);
+    }
+}
+
+// Returns true if the address of a local variable may be taken, in
+// which case the frame has to outlive calls made from the function.
+static bool takes_local_addr(Node *node) {
+    if(!node)
+        return false;
+
+    if(node->kind == ND_ADDR) {
+        Node *n = node->lhs;
+        while(n->kind == ND_MEMBER)
+            n = n->lhs;
+        if(n->kind == ND_VAR && n->var->is_local)
+            return true;
+    }
+
+    if(takes_local_addr(node->lhs) || takes_local_addr(node->rhs) ||
+       takes_local_addr(node->cond) || takes_local_addr(node->then) ||
+       takes_local_addr(node->els) || takes_local_addr(node->init) ||
+       takes_local_addr(node->inc))
+        return true;
+    for(Node *n = node->body; n; n = n->next)
+        if(takes_local_addr(n))
+            return true;
+    for(Node *n = node->args; n; n = n->next)
+        if(takes_local_addr(n))
+            return true;
+    return false;
+}
+
+static bool frame_escapes(Function *fn) {
+    // Arrays and structs are accessed through their addresses.
+    for(VarList *vl = fn->locals; vl; vl = vl->next) {
+        TypeKind kind = vl->var->ty->kind;
+        if(kind == TY_ARRAY || kind == TY_STRUCT)
+            return true;
     }
+    for(Node *node = fn->node; node; node = node->next)
+        if(takes_local_addr(node))
+            return true;
+    return false;
+}
+
+static bool has_self_tail_call(Node *node) {
+    if(!node)
+        return false;
+    if(node->kind == ND_RETURN && is_tail_call(node) && is_self_call(node->lhs))
+        return true;
+
+    if(has_self_tail_call(node->lhs) || has_self_tail_call(node->rhs) ||
+       has_self_tail_call(node->cond) || has_self_tail_call(node->then) ||
+       has_self_tail_call(node->els) || has_self_tail_call(node->init) ||
+       has_self_tail_call(node->inc))
+        return true;
+    for(Node *n = node->body; n; n = n->next)
+        if(has_self_tail_call(n))
+            return true;
+    for(Node *n = node->args; n; n = n->next)
+        if(has_self_tail_call(n))
+            return true;
+    return false;
+}
+
+static void gen_body(Function *fn) {
+    // 関数の引数をローカル変数のようにスタックにpushする
+    depth = 0;
+    max_depth = 0;
+    has_call = false;
+    call_sites = NULL;
+    int i = 0;
+    for(VarList *vl = fn->params; vl; vl = vl->next)
+        load_arg(vl->var, i++);
+
+    // Self tail calls jump here.
+    for(Node *node = fn->node; node; node = node->next) {
+        if(has_self_tail_call(node)) {
+            println(".L.body.%s:", fn->name);
+            break;
+        }
+    }
+
+    // Emit code
+    for (Node *node = fn->node; node; node = node->next) {
+        // 抽象構文木を降りながらコード生成
+        gen(node);
+    }
+
+    // Code moved out of line. Moving a block may find more to move.
+    if(cold_blocks)
+        println("    jmp .L.return.%s", fn->name);
+    while(cold_blocks) {
+        ColdBlock *cb = cold_blocks;
+        cold_blocks = cb->next;
+        println("#----- Cold code");
+        println("%s:", cb->label);
+        gen(cb->stmt);
+        println("    jmp %s", cb->end);
+    }
+
+    assert(depth == 0);
+}
+
+// Decides the frame layout of a function compiled without a frame
+// pointer. A dry run over the body tells whether the function is a leaf
+// and how deep its expression stack grows. Returns the frame size.
+static int layout_frame(Function *fn) {
+    int seq = labelseq;
+    int line_no = cur_line_no;
+    int col_no = cur_col_no;
+    emit_dry_run(true);
+    gen_body(fn);
+    emit_dry_run(false);
+    labelseq = seq;
+    cur_line_no = line_no;
+    cur_col_no = col_no;
+
+    // A leaf function keeps its locals in the 128-byte red zone below
+    // its deepest expression stack and does not touch rsp at all.
+    if(!has_call && fn->stack_size + max_depth * 8 <= 128) {
+        frame_off = -max_depth * 8;
+        frame_slots = 0;
+        return 0;
+    }
+
+    // Otherwise make rsp 16-byte aligned at depth 0 so that most calls
+    // need no adjustment. A function without locals has no frame at all.
+    int size = fn->stack_size;
+    if(size && has_call)
+        size += 8;
+    frame_off = size;
+    frame_slots = size / 8;
+    return size;
+}
+
+// -finstrument-cycles keeps a row of counters per function:
+//
+//   .L.cyc.table + 24*n:  calls, inclusive cycles, exclusive cycles
+//
+// The prologue saves the time stamp counter and the cycles spent in
+// callees so far (.L.cyc.child) below the locals, and the epilogue adds
+// the elapsed cycles to the row and to the callees' cycles of the
+// caller. rdx is the third argument on entry and rax the return value
+// on exit, so they are kept in r10 and r11 around rdtsc.
+static void gen_cycles_prologue(int stack_size) {
+    println("#----- Cycle counter");
+    println("    mov r10, rdx");
+    println("    lfence");
+    println("    rdtsc");
+    println("    shl rdx, 32");
+    println("    or rax, rdx");
+    println("    mov [rbp-%d], rax", stack_size + 8);
+    println("    mov rax, [rip+.L.cyc.child]");
+    println("    mov [rbp-%d], rax", stack_size + 16);
+    println("    mov qword ptr [rip+.L.cyc.child], 0");
+    println("    mov rdx, r10");
+}
+
+static void gen_cycles_epilogue(int stack_size, int n) {
+    println("#----- Cycle counter");
+    println("    mov r11, rax");
+    println("    lfence");
+    println("    rdtsc");
+    println("    shl rdx, 32");
+    println("    or rax, rdx");
+    println("    sub rax, [rbp-%d]", stack_size + 8);
+    println("    add qword ptr [rip+.L.cyc.table+%d], 1", n * 24);
+    println("    add [rip+.L.cyc.table+%d], rax", n * 24 + 8);
+    println("    mov rdx, rax");
+    println("    sub rdx, [rip+.L.cyc.child]");
+    println("    add [rip+.L.cyc.table+%d], rdx", n * 24 + 16);
+    println("    add rax, [rbp-%d]", stack_size + 16);
+    println("    mov [rip+.L.cyc.child], rax");
+    println("    mov rax, r11");
 }
 
 static void emit_text(Program *prog) {
     println(".text");
 
-    for(Function *fn = prog->fns; fn; fn = fn->next) {
-        println(".global %s", fn->name);
+    int fn_idx = 0;
+    for(Function *fn = prog->fns; fn; fn = fn->next, fn_idx++) {
+        if(!fn->is_static)
+            println(".global %s", fn->name);
+        println(".type %s, @function", fn->name);
         println("%s:", fn->name);
         funcname = fn->name;
+        current_fn = fn;
+
+        // The cycle counters need the frame pointer and an epilogue
+        // on every return.
+        omit_fp = opt_omit_frame_pointer && !opt_instrument_cycles;
+        tail_calls = opt_optimize_sibling_calls && !opt_instrument_cycles && !frame_escapes(fn);
+        int stack_size = fn->stack_size + (opt_instrument_cycles ? 16 : 0);
 
         // Prologue
         println("#----- Prologue");
-        println("    push rbp");
-        println("    mov rbp, rsp");
-        println("    sub rsp, %d", fn->stack_size);
-
-        // 関数の引数をローカル変数のようにスタックにpushする
-        int i = 0;
-        for(VarList *vl = fn->params; vl; vl = vl->next)
-            load_arg(vl->var, i++);
-
-        // Emit code
-        for (Node *node = fn->node; node; node = node->next) {
-            // 抽象構文木を降りながらコード生成
-            gen(node);
+        frame_size = 0;
+        if(omit_fp) {
+            frame_size = layout_frame(fn);
+            println("    .cfi_startproc");
+            if(frame_size)
+                println("    sub rsp, %d", frame_size);
+        } else {
+            frame_slots = 1 + stack_size / 8;
+            println("    .cfi_startproc");
+            println("    push rbp");
+            println("    .cfi_offset rbp, -16");
+            println("    mov rbp, rsp");
+            println("    .cfi_def_cfa_register rbp");
+            println("    sub rsp, %d", stack_size);
+            if(opt_instrument_cycles)
+                gen_cycles_prologue(fn->stack_size);
         }
 
+        gen_body(fn);
+
         // Epilogue
         println("#----- Epilogue");
         println(".L.return.%s:", funcname);     // ラベル(`.L`はファイルスコープ)
-        println("    mov rsp, rbp");
-        println("    pop rbp");
-        println("    ret");
+        if(omit_fp) {
+            if(frame_size)
+                println("    add rsp, %d", frame_size);
+            println("    ret");
+            println("    .cfi_endproc");
+        } else {
+            if(opt_instrument_cycles)
+                gen_cycles_epilogue(fn->stack_size, fn_idx);
+            println("    mov rsp, rbp");
+            println("    .cfi_def_cfa rsp, 16");
+            println("    pop rbp");
+            println("    .cfi_restore rbp");
+            println("    ret");
+            println("    .cfi_endproc");
+        }
+        println(".size %s, .-%s", fn->name, fn->name);
+
+        // A leaf without a frame keeps its locals in the red zone.
+        fn->frame_bytes = 8 * (1 + frame_slots);
+        if(omit_fp && !frame_size)
+            fn->frame_bytes += fn->stack_size;
+        fn->push_bytes = 8 * max_depth;
+        fn->calls = call_sites;
+        emit_flush();
+    }
+}
+
+// Emits the counters of -finstrument-cycles and a destructor that
+// writes a row per function to the cycles file when the program exits.
+static void emit_cycles_runtime(Program *prog) {
+    int n = 0;
+    for(Function *fn = prog->fns; fn; fn = fn->next)
+        n++;
+
+    println(".bss");
+    println(".align 8");
+    println(".L.cyc.child:");
+    println("    .zero 8");
+    println(".L.cyc.table:");
+    println("    .zero %d", n * 24);
+
+    println(".section .rodata");
+    int i = 0;
+    for(Function *fn = prog->fns; fn; fn = fn->next) {
+        println(".L.cyc.name.%d:", i++);
+        println("    .string \"%s\"", fn->name);
     }
+    println(".align 8");
+    println(".L.cyc.names:");
+    for(i = 0; i < n; i++)
+        println("    .quad .L.cyc.name.%d", i);
+    println(".L.cyc.path:");
+    println("    .string \"%s\"", opt_cycles_path);
+    println(".L.cyc.mode:");
+    println("    .string \"w\"");
+    println(".L.cyc.header:");
+    println("    .string \"# function calls inclusive-cycles exclusive-cycles\\n\"");
+    println(".L.cyc.fmt:");
+    println("    .string \"%%s %%ld %%ld %%ld\\n\"");
+
+    println(".section .fini_array,\"aw\"");
+    println(".align 8");
+    println("    .quad .L.cyc.write");
+
+    // rbx holds the file and r12 the index of the function.
+    println(".text");
+    println(".L.cyc.write:");
+    println("    .cfi_startproc");
+    println("    push rbx");
+    println("    .cfi_offset rbx, -16");
+    println("    push r12");
+    println("    .cfi_offset r12, -24");
+    println("    sub rsp, 8");
+    println("    lea rdi, [rip+.L.cyc.path]");
+    println("    lea rsi, [rip+.L.cyc.mode]");
+    println("    call fopen");
+    println("    test rax, rax");
+    println("    je .L.cyc.done");
+    println("    mov rbx, rax");
+    println("    mov rdi, rbx");
+    println("    lea rsi, [rip+.L.cyc.header]");
+    println("    mov eax, 0");
+    println("    call fprintf");
+    println("    mov r12, 0");
+    println(".L.cyc.loop:");
+    println("    cmp r12, %d", n);
+    println("    jge .L.cyc.close");
+    println("    mov rdi, rbx");
+    println("    lea rsi, [rip+.L.cyc.fmt]");
+    println("    lea rax, [rip+.L.cyc.names]");
+    println("    mov rdx, [rax+r12*8]");
+    println("    lea rax, [r12+r12*2]");
+    println("    lea r8, [rip+.L.cyc.table]");
+    println("    lea r8, [r8+rax*8]");
+    println("    mov rcx, [r8]");
+    println("    mov r9, [r8+16]");
+    println("    mov r8, [r8+8]");
+    println("    mov eax, 0");
+    println("    call fprintf");
+    println("    add r12, 1");
+    println("    jmp .L.cyc.loop");
+    println(".L.cyc.close:");
+    println("    mov rdi, rbx");
+    println("    call fclose");
+    println(".L.cyc.done:");
+    println("    add rsp, 8");
+    println("    pop r12");
+    println("    pop rbx");
+    println("    ret");
+    println("    .cfi_endproc");
+    emit_flush();
+}
+
+// Emits the counters of -fprofile-generate and a destructor that
+// writes them to the profile file when the program exits.
+static void emit_profile_runtime(void) {
+    println(".bss");
+    println(".align 8");
+    println(".L.prof.counts:");
+    println("    .zero %d", profile_size * 8);
+
+    println(".section .rodata");
+    println(".L.prof.path:");
+    println("    .string \"%s\"", opt_profile_path);
+    println(".L.prof.mode:");
+    println("    .string \"w\"");
+    println(".L.prof.header:");
+    println("    .string \"9cc-profile %d %u\\n\"", profile_size, profile_checksum);
+    println(".L.prof.fmt:");
+    println("    .string \"%%ld\\n\"");
+
+    println(".section .fini_array,\"aw\"");
+    println(".align 8");
+    println("    .quad .L.prof.write");
+
+    // rbx holds the file and r12 the index of the counter.
+    println(".text");
+    println(".L.prof.write:");
+    println("    .cfi_startproc");
+    println("    push rbx");
+    println("    .cfi_offset rbx, -16");
+    println("    push r12");
+    println("    .cfi_offset r12, -24");
+    println("    sub rsp, 8");
+    println("    lea rdi, [rip+.L.prof.path]");
+    println("    lea rsi, [rip+.L.prof.mode]");
+    println("    call fopen");
+    println("    test rax, rax");
+    println("    je .L.prof.done");
+    println("    mov rbx, rax");
+    println("    mov rdi, rbx");
+    println("    lea rsi, [rip+.L.prof.header]");
+    println("    mov eax, 0");
+    println("    call fprintf");
+    println("    mov r12, 0");
+    println(".L.prof.loop:");
+    println("    cmp r12, %d", profile_size);
+    println("    jge .L.prof.close");
+    println("    mov rdi, rbx");
+    println("    lea rsi, [rip+.L.prof.fmt]");
+    println("    lea rax, [rip+.L.prof.counts]");
+    println("    mov rdx, [rax+r12*8]");
+    println("    mov eax, 0");
+    println("    call fprintf");
+    println("    add r12, 1");
+    println("    jmp .L.prof.loop");
+    println(".L.prof.close:");
+    println("    mov rdi, rbx");
+    println("    call fclose");
+    println(".L.prof.done:");
+    println("    add rsp, 8");
+    println("    pop r12");
+    println("    pop rbx");
+    println("    ret");
+    println("    .cfi_endproc");
+    emit_flush();
 }
 
 void codegen(Program *prog) {
     // アセンブリの前半部分
     println(".intel_syntax noprefix");
     emit_data(prog);
+    emit_flush();
     emit_text(prog);
+    if(opt_profile_generate)
+        emit_profile_runtime();
+    if(opt_instrument_cycles)
+        emit_cycles_runtime(prog);
+
+    // The generated code does not need an executable stack.
+    println(".section .note.GNU-stack,\"\",@progbits");
+    emit_flush();
 }
@@ -0,0 +1,585 @@
+#include "9cc.h"
+
+// Assembly lines produced by codegen are not written out right away.
+// They are parsed into a list of instructions, labels and directives
+// which a peephole pass rewrites before the text is printed.
+
+typedef enum {
+    IN_INSN,      // instruction
+    IN_LABEL,     // label definition
+    IN_DIRECTIVE, // assembler directive
+    IN_COMMENT,   // comment
+} InsnKind;
+
+// A line of generated assembly
+typedef struct Insn Insn;
+struct Insn {
+    Insn *next;
+    Insn *prev;
+    InsnKind kind;
+    char *op;  // mnemonic, label name or the whole line
+    char *dst; // first operand
+    char *src; // second operand
+};
+
+typedef struct {
+    char *name;
+    bool (*fn)(Insn *insn);
+    int hits;
+} PeepholeRule;
+
+static Insn head = {};
+static Insn *tail = &head;
+
+// While set, generated lines are discarded.
+static bool dry_run;
+
+static char *skip_space(char *p) {
+    while(*p == ' ' || *p == '\t')
+        p++;
+    return p;
+}
+
+// Splits "op dst, src" into its parts.
+static void parse_insn(Insn *insn, char *p) {
+    char *q = p;
+    while(*q && *q != ' ')
+        q++;
+    insn->op = alloc_strndup(MEM_OUTPUT, p, q - p);
+
+    p = skip_space(q);
+    if(!*p)
+        return;
+
+    // Operands are separated by a comma outside of brackets.
+    int depth = 0;
+    for(q = p; *q; q++) {
+        if(*q == '[')
+            depth++;
+        else if(*q == ']')
+            depth--;
+        else if(*q == ',' && depth == 0)
+            break;
+    }
+
+    char *end = q;
+    while(end > p && end[-1] == ' ')
+        end--;
+    insn->dst = alloc_strndup(MEM_OUTPUT, p, end - p);
+
+    if(*q == ',')
+        insn->src = alloc_strndup(MEM_OUTPUT, skip_space(q + 1), strlen(q + 1));
+}
+
+static Insn *new_insn(char *line) {
+    Insn *insn = alloc(MEM_OUTPUT, sizeof(Insn));
+
+    if(line[0] == '#') {
+        insn->kind = IN_COMMENT;
+        insn->op = line;
+        return insn;
+    }
+
+    char *p = skip_space(line);
+    if(p != line && *p != '.') {
+        insn->kind = IN_INSN;
+        parse_insn(insn, p);
+        return insn;
+    }
+
+    int len = strlen(p);
+    if(p == line && len > 0 && p[len-1] == ':') {
+        insn->kind = IN_LABEL;
+        insn->op = alloc_strndup(MEM_OUTPUT, p, len - 1);
+        return insn;
+    }
+
+    insn->kind = IN_DIRECTIVE;
+    insn->op = line;
+    return insn;
+}
+
+// Appends a line of assembly to the instruction list.
+void println(char *fmt, ...) {
+    if(dry_run)
+        return;
+
+    va_list ap;
+    va_start(ap, fmt);
+    char *line;
+    if(vasprintf(&line, fmt, ap) < 0)
+        error("out of memory");
+    va_end(ap);
+    mem_account(MEM_OUTPUT, strlen(line) + 1);
+
+    Insn *insn = new_insn(line);
+    insn->prev = tail;
+    tail->next = insn;
+    tail = insn;
+}
+
+// Lets codegen run over a function without producing output.
+void emit_dry_run(bool on) {
+    dry_run = on;
+}
+
+static void insert_after(Insn *pos, Insn *insn) {
+    insn->prev = pos;
+    insn->next = pos->next;
+    if(pos->next)
+        pos->next->prev = insn;
+    else
+        tail = insn;
+    pos->next = insn;
+}
+
+static void remove_insn(Insn *insn) {
+    insn->prev->next = insn->next;
+    if(insn->next)
+        insn->next->prev = insn->prev;
+    else
+        tail = insn->prev;
+}
+
+static void set_insn(Insn *insn, char *op, char *dst, char *src) {
+    insn->op = op;
+    insn->dst = dst;
+    insn->src = src;
+}
+
+static bool is_op(Insn *insn, char *op) {
+    return insn && insn->kind == IN_INSN && !strcmp(insn->op, op);
+}
+
+// Comments and .loc directives do not affect the generated code.
+static bool is_transparent(Insn *insn) {
+    return insn->kind == IN_COMMENT ||
+           (insn->kind == IN_DIRECTIVE && !strncmp(skip_space(insn->op), ".loc ", 5));
+}
+
+static Insn *next_insn(Insn *insn) {
+    for(insn = insn->next; insn && is_transparent(insn); insn = insn->next)
+        ;
+    return insn;
+}
+
+//
+// Register model
+//
+
+static char *regs[][4] = {
+    {"rax", "eax", "ax", "al"},
+    {"rbx", "ebx", "bx", "bl"},
+    {"rcx", "ecx", "cx", "cl"},
+    {"rdx", "edx", "dx", "dl"},
+    {"rsi", "esi", "si", "sil"},
+    {"rdi", "edi", "di", "dil"},
+    {"rbp", "ebp", "bp", "bpl"},
+    {"rsp", "esp", "sp", "spl"},
+    {"r8", "r8d", "r8w", "r8b"},
+    {"r9", "r9d", "r9w", "r9b"},
+    {"r10", "r10d", "r10w", "r10b"},
+    {"r11", "r11d", "r11w", "r11b"},
+};
+
+// Returns the index of a general purpose register in `regs`, or -1.
+static int reg_index(char *name) {
+    if(!name)
+        return -1;
+    for(int i = 0; i < sizeof(regs) / sizeof(*regs); i++)
+        for(int j = 0; j < 4; j++)
+            if(!strcmp(name, regs[i][j]))
+                return i;
+    return -1;
+}
+
+// Returns true if the text of an operand mentions register `reg`.
+static bool mentions(char *opd, int reg) {
+    if(!opd)
+        return false;
+
+    for(char *p = opd; *p;) {
+        if(!isalnum(*p)) {
+            p++;
+            continue;
+        }
+        char *q = p;
+        while(isalnum(*q))
+            q++;
+        for(int j = 0; j < 4; j++) {
+            char *name = regs[reg][j];
+            if(strlen(name) == q - p && !strncmp(p, name, q - p))
+                return true;
+        }
+        p = q;
+    }
+    return false;
+}
+
+// Returns true if an operand uses rsp other than as the base of a
+// memory operand.
+static bool uses_rsp_reg(char *opd) {
+    return mentions(opd, reg_index("rsp")) && !strstr(opd, "[rsp");
+}
+
+// Adds `delta` to the displacement of an [rsp+...] memory operand.
+static char *shift_rsp_disp(char *opd, int delta) {
+    char *p = opd ? strstr(opd, "[rsp") : NULL;
+    if(!p)
+        return opd;
+
+    char *end = strchr(p, ']');
+    char *q = end;
+    while(isdigit(q[-1]))
+        q--;
+
+    long disp = 0;
+    if(q < end && (q[-1] == '+' || q[-1] == '-') && q[-2] != '*') {
+        q--;
+        disp = strtol(q, NULL, 10);
+    } else {
+        q = end;
+    }
+
+    disp += delta;
+    char *buf;
+    if(disp)
+        asprintf(&buf, "%.*s%+ld%s", (int)(q - opd), opd, disp, end);
+    else
+        asprintf(&buf, "%.*s%s", (int)(q - opd), opd, end);
+    mem_account(MEM_OUTPUT, strlen(buf) + 1);
+    return buf;
+}
+
+// Instructions whose first operand is written and that touch nothing
+// but their operands and the flags.
+static char *writers[] = {
+    "mov", "movsx", "movsxd", "movzb", "movzx", "lea", "add", "sub",
+    "imul", "and", "or", "xor", "sete", "setne", "setl", "setle",
+    "setg", "setge",
+};
+
+// Instructions which only read their operands.
+static char *readers[] = {"cmp", "test"};
+
+static bool in_list(char *op, char **list, int len) {
+    for(int i = 0; i < len; i++)
+        if(!strcmp(op, list[i]))
+            return true;
+    return false;
+}
+
+// Returns true if `insn` is known to leave register `reg` and the stack
+// alone. Anything not understood is treated as clobbering everything.
+static bool preserves(Insn *insn, int reg) {
+    if(insn->kind != IN_INSN)
+        return is_transparent(insn);
+
+    if(uses_rsp_reg(insn->dst) || uses_rsp_reg(insn->src))
+        return false;
+
+    if(in_list(insn->op, readers, sizeof(readers) / sizeof(*readers)))
+        return true;
+    if(!in_list(insn->op, writers, sizeof(writers) / sizeof(*writers)))
+        return false;
+
+    // A memory destination is not a register write.
+    if(insn->dst && strchr(insn->dst, '['))
+        return true;
+    return reg_index(insn->dst) != reg;
+}
+
+static bool reads_flags(Insn *insn) {
+    char *op = insn->op;
+    return op[0] == 'j' ? strcmp(op, "jmp") != 0 :
+           !strncmp(op, "set", 3) || !strncmp(op, "cmov", 4) ||
+           !strcmp(op, "adc") || !strcmp(op, "sbb");
+}
+
+static bool writes_flags(Insn *insn) {
+    static char *ops[] = {
+        "cmp", "test", "add", "sub", "and", "or", "xor", "imul", "idiv",
+        "call", "ret",
+    };
+    return in_list(insn->op, ops, sizeof(ops) / sizeof(*ops));
+}
+
+// Returns true if the flags are overwritten after `insn` before being read.
+static bool flags_dead_after(Insn *insn) {
+    for(Insn *i = next_insn(insn); i; i = next_insn(i)) {
+        if(i->kind != IN_INSN || reads_flags(i))
+            return false;
+        if(writes_flags(i))
+            return true;
+        if(!strcmp(i->op, "jmp"))
+            return false;
+    }
+    return false;
+}
+
+static bool is_imm(char *opd) {
+    return opd && (isdigit(*opd) || *opd == '-' || !strncmp(opd, "offset ", 7));
+}
+
+//
+// Peephole rules
+//
+
+// push X; ...; pop Y => mov Y, X
+// when the instructions in between neither touch the stack nor modify X.
+static bool push_pop(Insn *insn) {
+    if(!is_op(insn, "push"))
+        return false;
+
+    int src = reg_index(insn->dst);
+    if(src == -1 && !is_imm(insn->dst))
+        return false;
+
+    for(Insn *i = next_insn(insn); i; i = next_insn(i)) {
+        if(is_op(i, "pop")) {
+            int dst = reg_index(i->dst);
+            if(dst == -1)
+                return false;
+
+            // Without the pushed value rsp is 8 bytes higher in between.
+            for(Insn *j = insn->next; j != i; j = j->next) {
+                if(j->kind != IN_INSN)
+                    continue;
+                j->dst = shift_rsp_disp(j->dst, -8);
+                j->src = shift_rsp_disp(j->src, -8);
+            }
+
+            if(dst == src)
+                remove_insn(i);
+            else
+                set_insn(i, "mov", i->dst, insn->dst);
+            remove_insn(insn);
+            return true;
+        }
+        if(!preserves(i, src))
+            return false;
+    }
+    return false;
+}
+
+// push X; add rsp, 8 => (nothing)
+static bool push_discard(Insn *insn) {
+    if(!is_op(insn, "push"))
+        return false;
+    if(reg_index(insn->dst) == -1 && !is_imm(insn->dst))
+        return false;
+
+    Insn *next = next_insn(insn);
+    if(!is_op(next, "add") || strcmp(next->dst, "rsp") || strcmp(next->src, "8"))
+        return false;
+    remove_insn(insn);
+    remove_insn(next);
+    return true;
+}
+
+// mov r64, 0 => xor r32, r32
+static bool zero_reg(Insn *insn) {
+    if(!is_op(insn, "mov") || !insn->src || strcmp(insn->src, "0"))
+        return false;
+
+    int r = reg_index(insn->dst);
+    if(r == -1 || strcmp(insn->dst, regs[r][0]) || !flags_dead_after(insn))
+        return false;
+    set_insn(insn, "xor", regs[r][1], regs[r][1]);
+    return true;
+}
+
+// mov r, r => (nothing)
+static bool self_move(Insn *insn) {
+    if(!is_op(insn, "mov") || !insn->src || strcmp(insn->dst, insn->src))
+        return false;
+    if(reg_index(insn->dst) == -1)
+        return false;
+    remove_insn(insn);
+    return true;
+}
+
+// jmp L; L: => L:
+static bool jump_to_next(Insn *insn) {
+    if(!is_op(insn, "jmp"))
+        return false;
+
+    for(Insn *i = next_insn(insn); i && i->kind == IN_LABEL; i = next_insn(i)) {
+        if(!strcmp(i->op, insn->dst)) {
+            remove_insn(insn);
+            return true;
+        }
+    }
+    return false;
+}
+
+static PeepholeRule rules[] = {
+    {"push-pop", push_pop},
+    {"push-discard", push_discard},
+    {"zero-reg", zero_reg},
+    {"self-move", self_move},
+    {"jump-to-next", jump_to_next},
+};
+
+static void peephole(void) {
+    Insn *insn = head.next;
+
+    while(insn) {
+        bool changed = false;
+        Insn *prev = insn->prev;
+
+        for(int i = 0; i < sizeof(rules) / sizeof(*rules); i++) {
+            if(rules[i].fn(insn)) {
+                rules[i].hits++;
+                changed = true;
+                break;
+            }
+        }
+
+        // A rewrite may enable another match on the preceding instruction.
+        if(changed)
+            insn = (prev == &head) ? head.next : prev;
+        else
+            insn = insn->next;
+    }
+}
+
+void print_peephole_stats(void) {
+    for(int i = 0; i < sizeof(rules) / sizeof(*rules); i++)
+        fprintf(stderr, "peephole: %-14s %d\n", rules[i].name, rules[i].hits);
+}
+
+// Returns how many bytes an instruction pushes to the stack.
+static int stack_delta(Insn *insn) {
+    if(insn->kind != IN_INSN)
+        return 0;
+    if(!strcmp(insn->op, "push"))
+        return 8;
+    if(!strcmp(insn->op, "pop"))
+        return -8;
+    if(insn->dst && !strcmp(insn->dst, "rsp") && insn->src && isdigit(*insn->src)) {
+        if(!strcmp(insn->op, "sub"))
+            return atoi(insn->src);
+        if(!strcmp(insn->op, "add"))
+            return -atoi(insn->src);
+    }
+    return 0;
+}
+
+static bool is_directive(Insn *insn, char *name) {
+    return insn->kind == IN_DIRECTIVE &&
+           !strncmp(skip_space(insn->op), name, strlen(name));
+}
+
+// While the canonical frame address is computed from rsp, every
+// instruction that moves rsp needs a matching CFI directive for the
+// unwinder. They are inserted after the peephole pass has settled which
+// pushes and pops remain.
+static void insert_cfi(void) {
+    bool rsp_based = false;
+    bool saved = false;
+
+    for(Insn *insn = head.next; insn; insn = insn->next) {
+        if(is_directive(insn, ".cfi_startproc"))
+            rsp_based = true;
+        else if(is_directive(insn, ".cfi_remember_state"))
+            saved = rsp_based;
+        else if(is_directive(insn, ".cfi_restore_state"))
+            rsp_based = saved;
+        else if(is_directive(insn, ".cfi_def_cfa_register"))
+            rsp_based = false;
+        else if(is_directive(insn, ".cfi_def_cfa rsp"))
+            rsp_based = true;
+
+        int delta = stack_delta(insn);
+        if(!rsp_based || !delta)
+            continue;
+
+        char *line;
+        asprintf(&line, "    .cfi_adjust_cfa_offset %d", delta);
+        mem_account(MEM_OUTPUT, strlen(line) + 1);
+        insert_after(insn, new_insn(line));
+        insn = insn->next;
+    }
+}
+
+static bool is_loc(Insn *insn) {
+    return is_directive(insn, ".loc ");
+}
+
+// codegen emits a .loc for every node that starts at a new position, so
+// nested expressions leave several in a row. Only the last one before an
+// instruction gives the line table a row; the others are dropped.
+static void drop_dead_locs(void) {
+    Insn *pending = NULL;
+
+    for(Insn *insn = head.next; insn; insn = insn->next) {
+        if(insn->kind == IN_INSN) {
+            pending = NULL;
+        } else if(is_loc(insn)) {
+            if(pending)
+                remove_insn(pending);
+            pending = insn;
+        }
+    }
+}
+
+// Returns the number of bytes written.
+static int print_insn(Insn *insn) {
+    switch(insn->kind) {
+    case IN_INSN:
+        stats.asm_insns++;
+        if(insn->src)
+            return fprintf(output_file, "    %s %s, %s\n", insn->op, insn->dst, insn->src);
+        if(insn->dst)
+            return fprintf(output_file, "    %s %s\n", insn->op, insn->dst);
+        return fprintf(output_file, "    %s\n", insn->op);
+    case IN_LABEL:
+        return fprintf(output_file, "%s:\n", insn->op);
+    default:
+        return fprintf(output_file, "%s\n", insn->op);
+    }
+}
+
+// Hands a line to the integrated assembler. Nothing is written until
+// write_object(), so it returns 0.
+static int assemble_insn(Insn *insn) {
+    switch(insn->kind) {
+    case IN_INSN:
+        stats.asm_insns++;
+        asm_insn(insn->op, insn->dst, insn->src);
+        break;
+    case IN_LABEL:
+        asm_label(insn->op);
+        break;
+    case IN_DIRECTIVE:
+        asm_directive(insn->op);
+        break;
+    case IN_COMMENT:
+        break;
+    }
+    return 0;
+}
+
+// Optimizes the buffered instructions and writes them to the output
+// file, or with -c passes them to the assembler.
+void emit_flush(void) {
+    timevar_push(TV_EMIT);
+    if(opt_peephole)
+        peephole();
+    drop_dead_locs();
+    insert_cfi();
+
+    Insn *insn = head.next;
+    while(insn) {
+        Insn *next = insn->next;
+        stats.asm_bytes += opt_emit_object ? assemble_insn(insn) : print_insn(insn);
+        free(insn);
+        mem_release(MEM_OUTPUT, sizeof(Insn));
+        insn = next;
+    }
+
+    head.next = NULL;
+    tail = &head;
+    timevar_pop(TV_EMIT);
+}
@@ -2,8 +2,40 @@
 
 FILE *output_file;
 
+// Optimization flags
+bool opt_peephole = true;
+bool opt_sort_globals;
+bool opt_omit_frame_pointer;
+bool opt_inline = true;
+int opt_inline_limit = 20;
+bool opt_info_inline;
+bool opt_optimize_sibling_calls = true;
+bool opt_peel_loops = true;
+bool opt_unroll_loops;
+int opt_unroll_factor = 4;
+bool opt_align_loops = true;
+bool opt_move_loop_invariants = true;
+bool opt_ivopts = true;
+bool opt_cse = true;
+bool opt_tree_vectorize = true;
+bool opt_profile_generate;
+bool opt_profile_use;
+char *opt_profile_path;
+bool opt_instrument_cycles;
+bool opt_time_report;
+bool opt_time_report_json;
+bool opt_mem_report;
+bool opt_stack_usage;
+char *opt_stack_usage_path;
+int opt_frame_larger_than = -1;
+char *opt_cycles_path;
+bool opt_dce = true;
+bool opt_emit_object;
+static bool peephole_stats;
+static bool cse_stats;
+
 static char *input_path;
-static char *output_path = "-";
+static char *output_path;
 
 static char *filename;
 // 入力された文字列全体を受け取る変数
@@ -42,6 +74,7 @@ static char *read_file(char *path) {
 
     if(fp != stdin)
         fclose(fp);
+    mem_account(MEM_INPUT, buflen);
 
     // Canonicalize the last line by appending "\n\0"
     // if it does not end with a newline.
@@ -56,15 +89,78 @@ static char *read_file(char *path) {
 }
 
 static void usage(int status) {
-    fprintf(stderr, "9cc [ -o <path>] <file>\n");
+    fprintf(stderr, "9cc [ -o <path>] [ -c ] [ -O0 | -O1 | -O2 ] [ -fno-peephole ] [ -fpeephole-stats ] [ -fsort-globals ]\n"
+                    "    [ -fomit-frame-pointer ] [ -fno-inline ] [ -finline-limit=<n> ]\n"
+                    "    [ -fopt-info-inline ] [ -fno-optimize-sibling-calls ] [ -fno-peel-loops ]\n"
+                    "    [ -funroll-loops ] [ -funroll-factor=<n> ] [ -fno-align-loops ]\n"
+                    "    [ -fno-move-loop-invariants ] [ -fno-ivopts ] [ -fno-cse ] [ -fcse-stats ]\n"
+                    "    [ -fno-dce ] [ -fno-tree-vectorize ] [ -fprofile-generate[=<path>] ]\n"
+                    "    [ -fprofile-use[=<path>] ] [ -finstrument-cycles[=<path>] ]\n"
+                    "    [ -ftime-report[=json] ] [ -fmem-report ]\n"
+                    "    [ -fstack-usage ] [ -Wframe-larger-than=<n> ] [ -Rpass=<regex> ]\n"
+                    "    [ -Rpass-missed=<regex> ] [ -opt-bisect-limit=<n> ] <file>\n");
     exit(status);
 }
 
+// Returns `path` with ".c" replaced by `ext`.
+static char *replace_ext(char *path, char *ext) {
+    int len = strlen(path);
+    if(len > 2 && !strcmp(path + len - 2, ".c"))
+        len -= 2;
+    char *buf = calloc(1, len + strlen(ext) + 1);
+    sprintf(buf, "%.*s%s", len, path, ext);
+    return buf;
+}
+
+// -O0 turns off every optimization and -O1 leaves on the ones that cost
+// little compile time. -O2, the default, adds the loop optimizations
+// except unrolling.
+static void set_opt_level(int level) {
+    opt_peephole = level >= 1;
+    opt_inline = level >= 1;
+    opt_optimize_sibling_calls = level >= 1;
+    opt_cse = level >= 1;
+    opt_dce = level >= 1;
+    opt_peel_loops = level >= 2;
+    opt_align_loops = level >= 2;
+    opt_move_loop_invariants = level >= 2;
+    opt_ivopts = level >= 2;
+    opt_tree_vectorize = level >= 2;
+}
+
 static void parse_args(int argc, char **argv) {
+    // The -O level sets the defaults that -f flags then override in
+    // any order.
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-O"))
+            set_opt_level(1);
+        else if(!strcmp(argv[i], "-O0") || !strcmp(argv[i], "-O1") || !strcmp(argv[i], "-O2"))
+            set_opt_level(argv[i][2] - '0');
+    }
+
     for(int i = 1; i < argc; i++) {
         if(!strcmp(argv[i], "--help"))
             usage(0);
 
+        if(!strcmp(argv[i], "-O") || !strcmp(argv[i], "-O0") ||
+           !strcmp(argv[i], "-O1") || !strcmp(argv[i], "-O2"))
+            continue;
+
+        if(!strncmp(argv[i], "-Rpass=", 7)) {
+            set_remark_filter(false, argv[i] + 7);
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-Rpass-missed=", 14)) {
+            set_remark_filter(true, argv[i] + 14);
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-opt-bisect-limit=", 18)) {
+            opt_bisect_limit = atoi(argv[i] + 18);
+            continue;
+        }
+
         if(!strcmp(argv[i], "-o")) {
             if(!argv[++i])
                 usage(1);
@@ -77,6 +173,220 @@ static void parse_args(int argc, char **argv) {
             continue;
         }
 
+        if(!strcmp(argv[i], "-c")) {
+            opt_emit_object = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fpeephole")) {
+            opt_peephole = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-peephole")) {
+            opt_peephole = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fomit-frame-pointer")) {
+            opt_omit_frame_pointer = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-omit-frame-pointer")) {
+            opt_omit_frame_pointer = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-finline")) {
+            opt_inline = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-inline")) {
+            opt_inline = false;
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-finline-limit=", 15)) {
+            opt_inline_limit = atoi(argv[i] + 15);
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fopt-info-inline")) {
+            opt_info_inline = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-foptimize-sibling-calls")) {
+            opt_optimize_sibling_calls = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-optimize-sibling-calls")) {
+            opt_optimize_sibling_calls = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fpeel-loops")) {
+            opt_peel_loops = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-peel-loops")) {
+            opt_peel_loops = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-funroll-loops")) {
+            opt_unroll_loops = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-unroll-loops")) {
+            opt_unroll_loops = false;
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-funroll-factor=", 16)) {
+            opt_unroll_factor = atoi(argv[i] + 16);
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-falign-loops")) {
+            opt_align_loops = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-align-loops")) {
+            opt_align_loops = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fmove-loop-invariants")) {
+            opt_move_loop_invariants = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-move-loop-invariants")) {
+            opt_move_loop_invariants = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fivopts")) {
+            opt_ivopts = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-ivopts")) {
+            opt_ivopts = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fcse")) {
+            opt_cse = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-cse")) {
+            opt_cse = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fprofile-generate")) {
+            opt_profile_generate = true;
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-fprofile-generate=", 19)) {
+            opt_profile_generate = true;
+            opt_profile_path = argv[i] + 19;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fprofile-use")) {
+            opt_profile_use = true;
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-fprofile-use=", 14)) {
+            opt_profile_use = true;
+            opt_profile_path = argv[i] + 14;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-ftime-report")) {
+            opt_time_report = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-ftime-report=json")) {
+            opt_time_report = true;
+            opt_time_report_json = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fstack-usage")) {
+            opt_stack_usage = true;
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-Wframe-larger-than=", 20)) {
+            opt_frame_larger_than = atoi(argv[i] + 20);
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fmem-report")) {
+            opt_mem_report = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-finstrument-cycles")) {
+            opt_instrument_cycles = true;
+            continue;
+        }
+
+        if(!strncmp(argv[i], "-finstrument-cycles=", 20)) {
+            opt_instrument_cycles = true;
+            opt_cycles_path = argv[i] + 20;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-ftree-vectorize")) {
+            opt_tree_vectorize = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-tree-vectorize")) {
+            opt_tree_vectorize = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fdce")) {
+            opt_dce = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fno-dce")) {
+            opt_dce = false;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fcse-stats")) {
+            cse_stats = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fsort-globals")) {
+            opt_sort_globals = true;
+            continue;
+        }
+
+        if(!strcmp(argv[i], "-fpeephole-stats")) {
+            peephole_stats = true;
+            continue;
+        }
+
         if(argv[i][0] == '-' && argv[i][1] != '\0')
             error("unknown argument: %s", argv[i]);
 
@@ -85,6 +395,18 @@ static void parse_args(int argc, char **argv) {
 
     if(!input_path)
         error("no input files");
+    if(opt_profile_generate && opt_profile_use)
+        error("-fprofile-generate and -fprofile-use cannot be used together");
+
+    // foo.c => foo.o, foo.prof, foo.cycles, foo.su
+    if(!output_path)
+        output_path = opt_emit_object ? replace_ext(input_path, ".o") : "-";
+    if(!opt_profile_path)
+        opt_profile_path = replace_ext(input_path, ".prof");
+    if(!opt_cycles_path)
+        opt_cycles_path = replace_ext(input_path, ".cycles");
+    if(!opt_stack_usage_path)
+        opt_stack_usage_path = replace_ext(input_path, ".su");
 }
 
 int main(int argc, char **argv) {
@@ -105,12 +427,30 @@ int main(int argc, char **argv) {
 
     // トークナイズする
     filename = input_path;
+    timevar_push(TV_READ);
     user_input = read_file(input_path);
+    stats.input_bytes = strlen(user_input);
+    timevar_pop(TV_READ);
+    timevar_push(TV_LEX);
     token = tokenize(filename, user_input);
+    timevar_pop(TV_LEX);
     // トークナイズしたものをパースする(抽象構文木の形にする)
+    timevar_push(TV_PARSE);
     Program *prog = program(); // functionの連結リストが作成され、その先頭アドレス
+    timevar_pop(TV_PARSE);
     // それぞれのfunctionインスタンスごとにnodeやローカル変数のリストがメンバとして含まれている
 
+    // Profile counters are numbered before anything changes the tree.
+    timevar_push(TV_PROFILE);
+    if(opt_profile_generate || opt_profile_use)
+        number_profile_points(prog);
+    if(opt_profile_use)
+        read_profile(prog, opt_profile_path);
+    timevar_pop(TV_PROFILE);
+
+    run_passes(prog);
+
+    timevar_push(TV_FRAME);
     for(Function *fn = prog->fns; fn; fn = fn->next) {
         // ローカル変数にオフセットを割り当て
         int offset = 0;
@@ -121,15 +461,38 @@ int main(int argc, char **argv) {
             offset += var->ty->size;
             var->offset = offset;
         }
-        fn->stack_size = align_to(offset, 8);
+        // Keep RSP 16-byte aligned after the prologue so that codegen can
+        // align call sites statically.
+        fn->stack_size = align_to(offset, 16);
     }
+    timevar_pop(TV_FRAME);
 
     // Emit a .file directice for the assembler.
-    fprintf(output_file, ".file 1 \"%s\"\n", input_path);
+    println(".file 1 \"%s\"", input_path);
 
     // アセンブリコード生成
     // Traverse the AST to emit assembly.
+    timevar_push(TV_CODEGEN);
     codegen(prog);
+    timevar_pop(TV_CODEGEN);
+    if(opt_emit_object) {
+        timevar_push(TV_ASSEMBLE);
+        write_object(output_file);
+        timevar_pop(TV_ASSEMBLE);
+    }
+    fflush(output_file);
+
+    if(opt_stack_usage || opt_frame_larger_than >= 0)
+        report_stack_usage(prog, input_path);
+
+    if(peephole_stats)
+        print_peephole_stats();
+    if(cse_stats && opt_cse)
+        print_cse_stats();
+    if(opt_time_report)
+        print_time_report();
+    if(opt_mem_report)
+        print_mem_report();
 
     return 0;
 }
@@ -0,0 +1,1875 @@
+#include "9cc.h"
+
+// Returns true if a node of this kind has no side effects of its own.
+static bool is_pure_kind(NodeKind kind) {
+    switch(kind) {
+    case ND_NUM:
+    case ND_VAR:
+    case ND_ADD:
+    case ND_PTR_ADD:
+    case ND_SUB:
+    case ND_PTR_SUB:
+    case ND_PTR_DIFF:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_LOGAND:
+    case ND_LOGOR:
+    case ND_NOT:
+    case ND_COMMA:
+    case ND_MEMBER:
+    case ND_ADDR:
+    case ND_DEREF:
+        return true;
+    }
+    return false;
+}
+
+// Returns true if evaluating `node` has no side effects.
+bool is_pure(Node *node) {
+    if(!node)
+        return true;
+    return is_pure_kind(node->kind) && is_pure(node->lhs) && is_pure(node->rhs);
+}
+
+bool same_expr(Node *a, Node *b) {
+    if(!a || !b)
+        return a == b;
+    if(a->kind != b->kind)
+        return false;
+
+    switch(a->kind) {
+    case ND_NUM:
+        return a->val == b->val;
+    case ND_VAR:
+        return a->var == b->var;
+    case ND_MEMBER:
+        return a->member == b->member && same_expr(a->lhs, b->lhs);
+    }
+    return same_expr(a->lhs, b->lhs) && same_expr(a->rhs, b->rhs);
+}
+
+//
+// Function inlining
+//
+// A call to a small function is replaced with a statement expression
+// that holds a copy of the callee's body. The arguments are assigned to
+// fresh locals of the caller standing in for the parameters, and a
+// "return" in the copy leaves the statement expression with the return
+// value in rax instead of returning from the caller.
+//
+// e.g. `y = absval(x - 1);` becomes
+//   y = ({ int a = x - 1; if (a < 0) return' -a; return' a; });
+// where return' jumps to the end of the statement expression.
+//
+
+// Inlined calls nested within each other
+#define INLINE_DEPTH_MAX 8
+// Nodes that may be added to one function by inlining
+#define INLINE_GROWTH_MAX 1000
+
+static Function *fns;
+static Function *caller; // function being rewritten
+static int growth;       // nodes added to `caller` so far
+
+// Callees whose bodies are being expanded. A function is never inlined
+// into itself.
+static Function *inline_stack[INLINE_DEPTH_MAX];
+static int inline_depth;
+
+// Returns the number of nodes in a tree, which serves as its size.
+static int count_nodes(Node *node) {
+    if(!node)
+        return 0;
+
+    int n = 1;
+    n += count_nodes(node->lhs);
+    n += count_nodes(node->rhs);
+    n += count_nodes(node->cond);
+    n += count_nodes(node->then);
+    n += count_nodes(node->els);
+    n += count_nodes(node->init);
+    n += count_nodes(node->inc);
+    for(Node *n2 = node->body; n2; n2 = n2->next)
+        n += count_nodes(n2);
+    for(Node *n2 = node->args; n2; n2 = n2->next)
+        n += count_nodes(n2);
+    return n;
+}
+
+static int fn_size(Function *fn) {
+    int n = 0;
+    for(Node *node = fn->node; node; node = node->next)
+        n += count_nodes(node);
+    return n;
+}
+
+static Function *find_fn(char *name) {
+    for(Function *fn = fns; fn; fn = fn->next)
+        if(!strcmp(fn->name, name))
+            return fn;
+    return NULL;
+}
+
+// Counts the references to `fn` in a tree. Taking the address of a
+// function counts as well, so that such a function is never dropped.
+static int count_refs(Node *node, Function *fn) {
+    if(!node)
+        return 0;
+
+    int n = 0;
+    if(node->kind == ND_FUNCALL && !strcmp(node->funcname, fn->name))
+        n++;
+    if(node->kind == ND_VAR && node->var->ty->kind == TY_FUNC && !strcmp(node->var->name, fn->name))
+        n++;
+
+    n += count_refs(node->lhs, fn);
+    n += count_refs(node->rhs, fn);
+    n += count_refs(node->cond, fn);
+    n += count_refs(node->then, fn);
+    n += count_refs(node->els, fn);
+    n += count_refs(node->init, fn);
+    n += count_refs(node->inc, fn);
+    for(Node *n2 = node->body; n2; n2 = n2->next)
+        n += count_refs(n2, fn);
+    for(Node *n2 = node->args; n2; n2 = n2->next)
+        n += count_refs(n2, fn);
+    return n;
+}
+
+static int count_all_refs(Function *fn) {
+    int n = 0;
+    for(Function *f = fns; f; f = f->next)
+        for(Node *node = f->node; node; node = node->next)
+            n += count_refs(node, fn);
+    return n;
+}
+
+//
+// Copying subtrees
+//
+// An inlined body gets fresh locals standing in for the callee's, while
+// an unrolled loop body keeps using the same variables.
+//
+
+typedef struct VarMap VarMap;
+struct VarMap {
+    VarMap *next;
+    Var *from;
+    Var *to;
+};
+
+typedef struct NodeMap NodeMap;
+struct NodeMap {
+    NodeMap *next;
+    Node *from;
+    Node *to;
+};
+
+static bool rename_locals;    // give the copy its own locals
+static VarMap *var_map;       // callee locals => caller locals
+static NodeMap *region_map;   // inlined calls within the callee => their copies
+static Node *ret_target;      // what a "return" in the copy returns from
+
+static Var *new_local(Var *orig) {
+    Var *var = alloc(MEM_VAR, sizeof(Var));
+    var->name = orig->name;
+    var->ty = orig->ty;
+    var->is_local = true;
+
+    VarList *vl = alloc(MEM_VAR, sizeof(VarList));
+    vl->var = var;
+    vl->next = caller->locals;
+    caller->locals = vl;
+    return var;
+}
+
+static Var *map_var(Var *var) {
+    if(!var->is_local || !rename_locals)
+        return var;
+
+    for(VarMap *m = var_map; m; m = m->next)
+        if(m->from == var)
+            return m->to;
+
+    VarMap *m = alloc(MEM_OPT, sizeof(VarMap));
+    m->from = var;
+    m->to = new_local(var);
+    m->next = var_map;
+    var_map = m;
+    return m->to;
+}
+
+// Inlined calls outside of the copied subtree are kept.
+static Node *map_region(Node *node) {
+    for(NodeMap *m = region_map; m; m = m->next)
+        if(m->from == node)
+            return m->to;
+    return node;
+}
+
+static Node *copy_node(Node *node);
+
+static Node *copy_list(Node *node) {
+    Node head = {};
+    Node *cur = &head;
+    for(; node; node = node->next)
+        cur = cur->next = copy_node(node);
+    return head.next;
+}
+
+static Node *copy_node(Node *node) {
+    if(!node)
+        return NULL;
+
+    Node *n = alloc(MEM_NODE, sizeof(Node));
+    *n = *node;
+    n->next = NULL;
+
+    // The subtree may contain inlined calls; their returns have to
+    // target the copies.
+    if(node->inlined) {
+        NodeMap *m = alloc(MEM_OPT, sizeof(NodeMap));
+        m->from = node;
+        m->to = n;
+        m->next = region_map;
+        region_map = m;
+    }
+
+    n->lhs = copy_node(node->lhs);
+    n->rhs = copy_node(node->rhs);
+    n->cond = copy_node(node->cond);
+    n->then = copy_node(node->then);
+    n->els = copy_node(node->els);
+    n->init = copy_node(node->init);
+    n->inc = copy_node(node->inc);
+    n->body = copy_list(node->body);
+    n->args = copy_list(node->args);
+
+    if(node->kind == ND_VAR)
+        n->var = map_var(node->var);
+    if(node->kind == ND_RETURN)
+        n->target = node->target ? map_region(node->target) : ret_target;
+    return n;
+}
+
+//
+// Inlining decisions
+//
+
+static bool on_stack(Function *fn) {
+    for(int i = 0; i < inline_depth; i++)
+        if(inline_stack[i] == fn)
+            return true;
+    return false;
+}
+
+static bool is_scalar(Type *ty) {
+    return ty->kind != TY_ARRAY && ty->kind != TY_STRUCT;
+}
+
+// Returns true if a call to `fn` can be replaced with its body.
+static bool can_inline(Node *node, Function *fn) {
+    if(on_stack(fn) || inline_depth == INLINE_DEPTH_MAX)
+        return false;
+    if(!is_scalar(node->ty))
+        return false;
+
+    // Calls through an implicit declaration may not match the parameters.
+    Node *arg = node->args;
+    for(VarList *vl = fn->params; vl; vl = vl->next, arg = arg->next)
+        if(!arg || !is_scalar(vl->var->ty))
+            return false;
+    return !arg;
+}
+
+// A function is inlined if it is small enough, or it is static and
+// this is its only call site, in which case the function itself is
+// dropped afterwards. An "inline" function gets a larger budget.
+// With a profile, calls that never ran are left alone and hot ones
+// get the same allowance as calls to inline functions.
+static bool should_inline(Node *node, Function *fn, int size, int refs) {
+    if(fn->is_static && refs == 1)
+        return true;
+    if(profile_count(node, 0) == 0)
+        return false;
+
+    int limit = opt_inline_limit;
+    if(fn->is_inline || is_hot_call(node))
+        limit *= 4;
+    return size <= limit && growth + size <= INLINE_GROWTH_MAX;
+}
+
+static void inline_node(Node **p, Node *ret);
+
+// Replaces a call with a copy of the callee's body. If the call is the
+// operand of `ret`, a "return" in the copy can return from where `ret`
+// does directly, which keeps calls in tail position there.
+static Node *inline_call(Node *node, Node *ret) {
+    Function *fn = find_fn(node->funcname);
+    if(!fn)
+        return NULL;
+    if(!can_inline(node, fn)) {
+        remark_missed("inline", node->tok, "'%s' not inlined into '%s': recursive or not scalar",
+                      fn->name, caller->name);
+        return NULL;
+    }
+
+    int size = fn_size(fn);
+    int refs = fn->is_static ? count_all_refs(fn) : 0;
+    if(!should_inline(node, fn, size, refs)) {
+        remark_missed("inline", node->tok, "'%s' not inlined into '%s': too large or cold (size %d)",
+                      fn->name, caller->name, size);
+        return NULL;
+    }
+
+    Node *r = alloc(MEM_NODE, sizeof(Node));
+    r->kind = ND_STMT_EXPR;
+    r->tok = node->tok;
+    r->ty = node->ty;
+    r->inlined = fn;
+    r->prof_id = node->prof_id;
+
+    Node *saved_target = ret_target;
+    VarMap *saved_vars = var_map;
+    NodeMap *saved_regions = region_map;
+    ret_target = ret ? ret->target : r;
+    rename_locals = true;
+    var_map = NULL;
+    region_map = NULL;
+
+    // Parameters are assigned the arguments in order.
+    Node head = {};
+    Node *cur = &head;
+    Node *arg = node->args;
+    for(VarList *vl = fn->params; vl; vl = vl->next) {
+        Node *lhs = alloc(MEM_NODE, sizeof(Node));
+        lhs->kind = ND_VAR;
+        lhs->tok = arg->tok;
+        lhs->var = map_var(vl->var);
+        lhs->ty = lhs->var->ty;
+
+        Node *assign = alloc(MEM_NODE, sizeof(Node));
+        assign->kind = ND_ASSIGN;
+        assign->tok = arg->tok;
+        assign->lhs = lhs;
+        assign->rhs = arg;
+        assign->ty = lhs->ty;
+
+        Node *next = arg->next;
+        arg->next = NULL;
+        arg = next;
+
+        cur = cur->next = alloc(MEM_NODE, sizeof(Node));
+        cur->kind = ND_EXPR_STMT;
+        cur->tok = assign->tok;
+        cur->lhs = assign;
+        cur->ty = assign->ty;
+    }
+
+    Node *body = copy_list(fn->node);
+
+    ret_target = saved_target;
+    var_map = saved_vars;
+    region_map = saved_regions;
+    growth += size;
+
+    if(opt_info_inline)
+        info_tok(node->tok, "inlined '%s' into '%s' (size %d)", fn->name, caller->name, size);
+    remark("inline", node->tok, "'%s' inlined into '%s' (size %d)", fn->name, caller->name, size);
+
+    // Calls in the copied body may be inlined in turn.
+    inline_stack[inline_depth++] = fn;
+    for(Node **q = &body; *q; q = &(*q)->next)
+        inline_node(q, NULL);
+    inline_depth--;
+
+    cur->next = body;
+    r->body = head.next;
+    return r;
+}
+
+static void inline_node(Node **p, Node *ret) {
+    Node *node = *p;
+    if(!node)
+        return;
+
+    inline_node(&node->lhs, node->kind == ND_RETURN ? node : NULL);
+    inline_node(&node->rhs, NULL);
+    inline_node(&node->cond, NULL);
+    inline_node(&node->then, NULL);
+    inline_node(&node->els, NULL);
+    inline_node(&node->init, NULL);
+    inline_node(&node->inc, NULL);
+    for(Node **q = &node->body; *q; q = &(*q)->next)
+        inline_node(q, NULL);
+    for(Node **q = &node->args; *q; q = &(*q)->next)
+        inline_node(q, NULL);
+
+    if(node->kind != ND_FUNCALL)
+        return;
+
+    Node *r = inline_call(node, ret);
+    if(r) {
+        r->next = node->next;
+        *p = r;
+    }
+}
+
+void inline_functions(Program *prog) {
+    fns = prog->fns;
+
+    for(Function *fn = prog->fns; fn; fn = fn->next) {
+        if(!should_run_pass("inline", fn))
+            continue;
+        caller = fn;
+        growth = 0;
+        inline_stack[0] = fn;
+        inline_depth = 1;
+        for(Node **q = &fn->node; *q; q = &(*q)->next)
+            inline_node(q, NULL);
+    }
+
+    // Drop static functions that are no longer called. Dropping one
+    // may leave another without callers.
+    for(bool changed = true; changed;) {
+        changed = false;
+        for(Function **fp = &prog->fns; *fp;) {
+            Function *fn = *fp;
+            fns = prog->fns;
+            if(fn->is_static && count_all_refs(fn) == 0) {
+                if(opt_info_inline)
+                    fprintf(stderr, "removed unused static function '%s'\n", fn->name);
+                *fp = fn->next;
+                changed = true;
+                continue;
+            }
+            fp = &fn->next;
+        }
+    }
+}
+
+//
+// Loop unrolling
+//
+// A counted loop of the form
+//
+//   for (i = start; i < limit; i = i + step) body
+//
+// whose body neither assigns `i` nor `limit` is fully unrolled if both
+// bounds are constants and it runs only a few times:
+//
+//   i = start; body; i = i + step; body; i = i + step; ...
+//
+// With -funroll-loops other counted loops are unrolled by a factor of
+// N and followed by a remainder loop for the last iterations:
+//
+//   for (i = start; i + (N-1)*step < limit;) { body; i = i + step; ... }
+//   for (; i < limit; i = i + step) body
+//
+
+#define PEEL_MAX_TRIPS 8    // iterations of a fully unrolled loop
+#define PEEL_MAX_SIZE 200   // nodes of a fully unrolled loop
+#define UNROLL_MAX_SIZE 60  // nodes of a loop body unrolled by a factor
+
+// Returns true if `pred` holds for any node in a tree.
+static bool find_node(Node *node, bool (*pred)(Node *node, void *arg), void *arg) {
+    if(!node)
+        return false;
+    if(pred(node, arg))
+        return true;
+
+    if(find_node(node->lhs, pred, arg) || find_node(node->rhs, pred, arg) ||
+       find_node(node->cond, pred, arg) || find_node(node->then, pred, arg) ||
+       find_node(node->els, pred, arg) || find_node(node->init, pred, arg) ||
+       find_node(node->inc, pred, arg))
+        return true;
+    for(Node *n = node->body; n; n = n->next)
+        if(find_node(n, pred, arg))
+            return true;
+    for(Node *n = node->args; n; n = n->next)
+        if(find_node(n, pred, arg))
+            return true;
+    return false;
+}
+
+static bool is_var(Node *node, Var *var) {
+    return node->kind == ND_VAR && node->var == var;
+}
+
+static bool assigns(Node *node, void *var) {
+    return node->kind == ND_ASSIGN && is_var(node->lhs, var);
+}
+
+static VarList *escaped; // locals of `caller` whose address is taken
+
+static bool collect_escaped(Node *node, void *arg) {
+    if(node->kind != ND_ADDR)
+        return false;
+    Node *n = node->lhs;
+    while(n->kind == ND_MEMBER)
+        n = n->lhs;
+    if(n->kind != ND_VAR || !n->var->is_local)
+        return false;
+
+    VarList *vl = alloc(MEM_VAR, sizeof(VarList));
+    vl->var = n->var;
+    vl->next = escaped;
+    escaped = vl;
+    return false;
+}
+
+// The passes below never take new addresses, so this is done once per
+// function before they look at it.
+static void find_escaped(void) {
+    escaped = NULL;
+    for(Node *node = caller->node; node; node = node->next)
+        find_node(node, collect_escaped, NULL);
+}
+
+// A local whose address is never taken can only change by assignment.
+static bool is_private(Var *var) {
+    if(!var->is_local)
+        return false;
+    for(VarList *vl = escaped; vl; vl = vl->next)
+        if(vl->var == var)
+            return false;
+    return true;
+}
+
+static Node *new_node(NodeKind kind, Token *tok) {
+    Node *node = alloc(MEM_NODE, sizeof(Node));
+    node->kind = kind;
+    node->tok = tok;
+    return node;
+}
+
+static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
+    Node *node = new_node(kind, tok);
+    node->lhs = lhs;
+    node->rhs = rhs;
+    add_type(node);
+    return node;
+}
+
+static Node *new_num(long val, Token *tok) {
+    Node *node = new_node(ND_NUM, tok);
+    node->val = val;
+    add_type(node);
+    return node;
+}
+
+typedef struct {
+    Var *var;     // induction variable
+    Node *start;
+    Node *limit;  // a constant or a local
+    long step;
+} CountedLoop;
+
+static bool match_counted_loop(Node *node, CountedLoop *l) {
+    if(node->kind != ND_FOR || !node->init || !node->cond || !node->inc)
+        return false;
+
+    Node *init = node->init->lhs;
+    if(init->kind != ND_ASSIGN || init->lhs->kind != ND_VAR)
+        return false;
+    Var *var = init->lhs->var;
+    if(!is_integer(var->ty) || var->ty->size < 4 || !is_private(var))
+        return false;
+
+    Node *cond = node->cond;
+    if((cond->kind != ND_LT && cond->kind != ND_LE) || !is_var(cond->lhs, var))
+        return false;
+    Node *limit = cond->rhs;
+    if(limit->kind == ND_VAR) {
+        if(limit->var == var || !is_private(limit->var) ||
+           find_node(node->then, assigns, limit->var))
+            return false;
+    } else if(limit->kind != ND_NUM) {
+        return false;
+    }
+
+    Node *inc = node->inc->lhs;
+    if(inc->kind != ND_ASSIGN || !is_var(inc->lhs, var) || inc->rhs->kind != ND_ADD ||
+       !is_var(inc->rhs->lhs, var) || inc->rhs->rhs->kind != ND_NUM || inc->rhs->rhs->val <= 0)
+        return false;
+    if(find_node(node->then, assigns, var))
+        return false;
+
+    l->var = var;
+    l->start = init->rhs;
+    l->limit = limit;
+    l->step = inc->rhs->rhs->val;
+    return true;
+}
+
+static Node *copy_tree(Node *node) {
+    rename_locals = false;
+    region_map = NULL;
+    ret_target = NULL;
+    return copy_node(node);
+}
+
+// Appends `n` copies of the loop body, each followed by the increment.
+static Node *append_iterations(Node *cur, Node *loop, int n) {
+    for(int i = 0; i < n; i++) {
+        cur = cur->next = copy_tree(loop->then);
+        cur = cur->next = copy_tree(loop->inc);
+    }
+    return cur;
+}
+
+static Node *new_block(Node *body, Token *tok) {
+    Node *node = new_node(ND_BLOCK, tok);
+    node->body = body;
+    return node;
+}
+
+// Returns the number of iterations of a loop with constant bounds, or
+// -1 if there are more than PEEL_MAX_TRIPS.
+static int count_trips(Node *loop, CountedLoop *l) {
+    if(l->start->kind != ND_NUM || l->limit->kind != ND_NUM)
+        return -1;
+
+    int trips = 0;
+    bool inclusive = (loop->cond->kind == ND_LE);
+    for(long v = l->start->val; inclusive ? v <= l->limit->val : v < l->limit->val; v += l->step)
+        if(++trips > PEEL_MAX_TRIPS)
+            return -1;
+    return trips;
+}
+
+static Node *peel_loop(Node *loop, CountedLoop *l) {
+    int trips = count_trips(loop, l);
+    int size = count_nodes(loop->then) + count_nodes(loop->inc);
+    if(trips < 0 || trips * size > PEEL_MAX_SIZE)
+        return NULL;
+
+    Node head = {};
+    Node *cur = &head;
+    cur = cur->next = loop->init;
+    append_iterations(cur, loop, trips);
+    return new_block(head.next, loop->tok);
+}
+
+static Node *unroll_loop(Node *loop, CountedLoop *l) {
+    int n = opt_unroll_factor;
+    int size = count_nodes(loop->then) + count_nodes(loop->inc);
+    if(n < 2 || size > UNROLL_MAX_SIZE)
+        return NULL;
+
+    Token *tok = loop->tok;
+    Node *var = new_node(ND_VAR, tok);
+    var->var = l->var;
+    add_type(var);
+
+    Node head = {};
+    Node *body = &head;
+    append_iterations(body, loop, n);
+
+    Node *fast = new_node(ND_FOR, tok);
+    fast->init = loop->init;
+    fast->cond = new_binary(loop->cond->kind,
+                            new_binary(ND_ADD, var, new_num((n - 1) * l->step, tok), tok),
+                            copy_tree(l->limit), tok);
+    fast->then = new_block(head.next, tok);
+
+    loop->init = NULL;
+    loop->next = NULL;
+    fast->next = loop;
+    return new_block(fast, tok);
+}
+
+static void unroll_node(Node **p) {
+    Node *node = *p;
+    if(!node)
+        return;
+
+    // Inner loops first
+    unroll_node(&node->lhs);
+    unroll_node(&node->rhs);
+    unroll_node(&node->cond);
+    unroll_node(&node->then);
+    unroll_node(&node->els);
+    unroll_node(&node->init);
+    unroll_node(&node->inc);
+    for(Node **q = &node->body; *q; q = &(*q)->next)
+        unroll_node(q);
+    for(Node **q = &node->args; *q; q = &(*q)->next)
+        unroll_node(q);
+
+    // A vectorized loop stays as the scalar tail of the vector loop.
+    CountedLoop l;
+    if(node->vec || !match_counted_loop(node, &l))
+        return;
+
+    Node *next = node->next;
+    Token *tok = node->tok;
+    Node *r = opt_peel_loops ? peel_loop(node, &l) : NULL;
+    if(r) {
+        remark("unroll", tok, "loop peeled");
+    } else if(opt_unroll_loops) {
+        r = unroll_loop(node, &l);
+        if(r)
+            remark("unroll", tok, "loop unrolled by a factor of %d", opt_unroll_factor);
+        else
+            remark_missed("unroll", tok, "loop not unrolled: body too large");
+    }
+    if(r) {
+        r->next = next;
+        *p = r;
+    }
+}
+
+void unroll_loops(Program *prog) {
+    for(Function *fn = prog->fns; fn; fn = fn->next) {
+        if(!should_run_pass("unroll", fn))
+            continue;
+        caller = fn;
+        find_escaped();
+        for(Node **q = &fn->node; *q; q = &(*q)->next)
+            unroll_node(q);
+    }
+}
+
+//
+// Loop-invariant code motion and induction variable strength reduction
+//
+// Expressions in a loop whose values do not change between iterations
+// are computed into new locals once before the loop:
+//
+//   while (t[i] != t[j]) j = j + 1;
+// =>
+//   x = t[i]; while (x != t[j]) j = j + 1;
+//
+// and the address `base + j` indexed by a variable that is only stepped
+// by a constant becomes a pointer that is stepped along with it:
+//
+//   x = t[i]; p = t + j; while (x != *p) { j = j + 1; p = p + 1; }
+//
+// Code before the loop runs even if the loop body never does, so an
+// expression that may fault (a load or a division) is only hoisted if
+// it is evaluated anyway the first time the condition is.
+//
+
+static Node *loop;             // loop being optimized
+static bool loop_writes_memory; // the loop may change memory other than locals
+static Node *pre;              // last statement of the code hoisted before the loop
+static NodeMap *hoisted;       // hoisted expressions => their locals
+
+// A scalar local whose address is never taken behaves like a register:
+// it is only changed by assignments to it.
+static bool is_reg_var(Var *var) {
+    return var->ty->kind != TY_ARRAY && var->ty->kind != TY_STRUCT && is_private(var);
+}
+
+static bool find_in_loop(bool (*pred)(Node *node, void *arg), void *arg) {
+    return find_node(loop->cond, pred, arg) || find_node(loop->then, pred, arg) ||
+           find_node(loop->inc, pred, arg);
+}
+
+static bool writes_memory(Node *node, void *arg) {
+    if(node->kind == ND_FUNCALL)
+        return true;
+    return node->kind == ND_ASSIGN &&
+           !(node->lhs->kind == ND_VAR && is_reg_var(node->lhs->var));
+}
+
+// Returns true if the value of `node` may change within the loop.
+static bool varies(Node *node, void *arg) {
+    if(node->kind == ND_DEREF)
+        return loop_writes_memory;
+    if(node->kind != ND_VAR || node->var->ty->kind == TY_ARRAY)
+        return false;
+    if(!is_reg_var(node->var))
+        return loop_writes_memory;
+    return find_in_loop(assigns, node->var);
+}
+
+static bool is_invariant(Node *node) {
+    return is_pure(node) && !find_node(node, varies, NULL);
+}
+
+static bool faults(Node *node, void *arg) {
+    return node->kind == ND_DEREF || node->kind == ND_DIV;
+}
+
+static bool may_fault(Node *node) {
+    return find_node(node, faults, NULL);
+}
+
+static Var *new_temp(Type *ty) {
+    Var *var = alloc(MEM_VAR, sizeof(Var));
+    var->name = "tmp";
+    var->ty = ty;
+    var->is_local = true;
+
+    VarList *vl = alloc(MEM_VAR, sizeof(VarList));
+    vl->var = var;
+    vl->next = caller->locals;
+    caller->locals = vl;
+    return var;
+}
+
+static Node *new_var_node(Var *var, Token *tok) {
+    Node *node = new_node(ND_VAR, tok);
+    node->var = var;
+    add_type(node);
+    return node;
+}
+
+static Node *new_assign(Var *var, Node *rhs) {
+    Node *node = new_binary(ND_ASSIGN, new_var_node(var, rhs->tok), rhs, rhs->tok);
+    Node *stmt = new_node(ND_EXPR_STMT, rhs->tok);
+    stmt->lhs = node;
+    return stmt;
+}
+
+// Makes `node` read `var` in place.
+static void replace_with_var(Node *node, Var *var) {
+    Node *next = node->next;
+    Token *tok = node->tok;
+    memset(node, 0, sizeof(Node));
+    node->kind = ND_VAR;
+    node->tok = tok;
+    node->var = var;
+    node->ty = var->ty;
+    node->next = next;
+}
+
+// Computes `node` into a local before the loop and makes `node` read
+// that local instead. An expression hoisted earlier is reused.
+static void hoist_node(Node *node) {
+    Var *var = NULL;
+    for(NodeMap *m = hoisted; m; m = m->next)
+        if(same_expr(m->from, node))
+            var = m->to->var;
+
+    if(!var) {
+        Node *expr = alloc(MEM_NODE, sizeof(Node));
+        *expr = *node;
+        expr->next = NULL;
+
+        var = new_temp(node->ty);
+        pre = pre->next = new_assign(var, expr);
+
+        NodeMap *m = alloc(MEM_OPT, sizeof(NodeMap));
+        m->from = expr;
+        m->to = new_var_node(var, node->tok);
+        m->next = hoisted;
+        hoisted = m;
+        remark("licm", node->tok, "loop-invariant expression hoisted out of the loop");
+    }
+
+    replace_with_var(node, var);
+}
+
+static bool is_hoisted(Node *node) {
+    for(NodeMap *m = hoisted; m; m = m->next)
+        if(same_expr(m->from, node))
+            return true;
+    return false;
+}
+
+static bool is_hoistable(Node *node) {
+    switch(node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+    case ND_ADDR:
+        return false;
+    }
+    if(!node->ty || (!is_integer(node->ty) && node->ty->kind != TY_PTR))
+        return false;
+    return is_invariant(node);
+}
+
+// `always` tells if `node` is evaluated whenever the loop condition is,
+// and `lvalue` if `node` is the object of an assignment or "&".
+static void hoist(Node *node, bool always, bool lvalue) {
+    if(!node)
+        return;
+
+    // Once an expression is computed before the loop, other occurrences
+    // can use it no matter where they are.
+    if(!lvalue && is_hoistable(node) && (always || !may_fault(node) || is_hoisted(node))) {
+        hoist_node(node);
+        return;
+    }
+
+    switch(node->kind) {
+    case ND_ASSIGN:
+        hoist(node->lhs, always, true);
+        hoist(node->rhs, always, false);
+        return;
+    case ND_ADDR:
+        hoist(node->lhs, always, true);
+        return;
+    case ND_MEMBER:
+        hoist(node->lhs, always, true);
+        return;
+    case ND_DEREF:
+        hoist(node->lhs, always, false);
+        return;
+    case ND_LOGAND:
+    case ND_LOGOR:
+        hoist(node->lhs, always, false);
+        hoist(node->rhs, false, false);
+        return;
+    }
+
+    hoist(node->lhs, always, false);
+    hoist(node->rhs, always, false);
+    hoist(node->cond, false, false);
+    hoist(node->then, false, false);
+    hoist(node->els, false, false);
+    hoist(node->init, false, false);
+    hoist(node->inc, false, false);
+    for(Node *n = node->body; n; n = n->next)
+        hoist(n, false, false);
+    for(Node *n = node->args; n; n = n->next)
+        hoist(n, false, false);
+}
+
+typedef struct {
+    Var *var;
+    int count;
+} VarCount;
+
+static bool count_assigns(Node *node, void *arg) {
+    VarCount *vc = arg;
+    if(assigns(node, vc->var))
+        vc->count++;
+    return false;
+}
+
+// Returns the variable of `var = var + step`.
+static Var *match_step(Node *stmt, long *step) {
+    if(stmt->kind != ND_EXPR_STMT)
+        return NULL;
+    Node *node = stmt->lhs;
+    if(node->kind != ND_ASSIGN || node->lhs->kind != ND_VAR)
+        return NULL;
+    Var *var = node->lhs->var;
+    if(!is_integer(var->ty) || !is_reg_var(var))
+        return NULL;
+    if(node->rhs->kind != ND_ADD || !is_var(node->rhs->lhs, var) || node->rhs->rhs->kind != ND_NUM)
+        return NULL;
+
+    VarCount vc = {var, 0};
+    find_in_loop(count_assigns, &vc);
+    if(vc.count != 1)
+        return NULL;
+    *step = node->rhs->rhs->val;
+    return var;
+}
+
+static Var *iv;          // induction variable being reduced
+static NodeMap *iv_ptrs; // bases => pointers stepped with `iv`
+
+// Replaces `base + iv` with a pointer.
+static void reduce_addr(Node *node) {
+    if(!node)
+        return;
+
+    if(node->kind == ND_PTR_ADD && is_var(node->rhs, iv) &&
+       is_invariant(node->lhs) && !may_fault(node->lhs)) {
+        Node *ptr = NULL;
+        for(NodeMap *m = iv_ptrs; m; m = m->next)
+            if(same_expr(m->from, node->lhs))
+                ptr = m->to;
+
+        if(!ptr) {
+            // `array + i` has the type of the array.
+            Var *var = new_temp(pointer_to(node->ty->base));
+            pre = pre->next = new_assign(var, copy_tree(node));
+
+            NodeMap *m = alloc(MEM_OPT, sizeof(NodeMap));
+            m->from = node->lhs;
+            m->to = ptr = new_var_node(var, node->tok);
+            m->next = iv_ptrs;
+            iv_ptrs = m;
+        }
+
+        Node *next = node->next;
+        *node = *ptr;
+        node->next = next;
+        return;
+    }
+
+    reduce_addr(node->lhs);
+    reduce_addr(node->rhs);
+    reduce_addr(node->cond);
+    reduce_addr(node->then);
+    reduce_addr(node->els);
+    reduce_addr(node->init);
+    reduce_addr(node->inc);
+    for(Node *n = node->body; n; n = n->next)
+        reduce_addr(n);
+    for(Node *n = node->args; n; n = n->next)
+        reduce_addr(n);
+}
+
+// Strength-reduces the induction variable stepped by `*stmt`. The new
+// pointers are stepped right after it.
+static void reduce_iv(Node **stmt, Var *var, long step) {
+    iv = var;
+    iv_ptrs = NULL;
+    reduce_addr(loop->cond);
+    reduce_addr(loop->then);
+    reduce_addr(loop->inc);
+    if(!iv_ptrs)
+        return;
+    remark("licm", (*stmt)->tok, "induction variable '%s' strength-reduced", var->name);
+
+    Node *s = *stmt;
+    Node *next = s->next;
+    Node head = {};
+    Node *cur = &head;
+    cur = cur->next = s;
+    for(NodeMap *m = iv_ptrs; m; m = m->next) {
+        Node *ptr = m->to;
+        Node *rhs = new_binary(ND_PTR_ADD, new_var_node(ptr->var, s->tok), new_num(step, s->tok), s->tok);
+        cur = cur->next = new_assign(ptr->var, rhs);
+    }
+
+    // A statement in a block is followed by the updates; otherwise the
+    // statement and the updates become a block.
+    if(stmt != &loop->then && stmt != &loop->inc) {
+        cur->next = next;
+        return;
+    }
+    cur->next = NULL;
+    *stmt = new_block(head.next, s->tok);
+}
+
+static void reduce_ivs(void) {
+    long step;
+    Var *var;
+
+    if(loop->inc && (var = match_step(loop->inc, &step)))
+        reduce_iv(&loop->inc, var, step);
+
+    if(loop->then->kind == ND_BLOCK) {
+        for(Node **q = &loop->then->body; *q; q = &(*q)->next)
+            if(var = match_step(*q, &step))
+                reduce_iv(q, var, step);
+    } else if(var = match_step(loop->then, &step)) {
+        reduce_iv(&loop->then, var, step);
+    }
+}
+
+static void licm_node(Node **p) {
+    Node *node = *p;
+    if(!node)
+        return;
+
+    // Inner loops first
+    licm_node(&node->lhs);
+    licm_node(&node->rhs);
+    licm_node(&node->cond);
+    licm_node(&node->then);
+    licm_node(&node->els);
+    licm_node(&node->init);
+    licm_node(&node->inc);
+    for(Node **q = &node->body; *q; q = &(*q)->next)
+        licm_node(q);
+    for(Node **q = &node->args; *q; q = &(*q)->next)
+        licm_node(q);
+
+    if((node->kind != ND_WHILE && node->kind != ND_FOR) || node->vec)
+        return;
+
+    loop = node;
+    loop_writes_memory = find_in_loop(writes_memory, NULL);
+    hoisted = NULL;
+
+    // The code before the loop comes after the initialization of "for".
+    Node head = {};
+    pre = &head;
+    if(node->init) {
+        pre = pre->next = node->init;
+        node->init = NULL;
+    }
+    Node *first = pre;
+
+    if(opt_ivopts)
+        reduce_ivs();
+    if(opt_move_loop_invariants) {
+        hoist(node->cond, true, false);
+        hoist(node->then, false, false);
+        hoist(node->inc, false, false);
+    }
+
+    if(pre == first) {
+        node->init = (first == &head) ? NULL : first;
+        return;
+    }
+
+    Node *next = node->next;
+    node->next = NULL;
+    pre->next = node;
+    Node *block = new_block(head.next, node->tok);
+    block->next = next;
+    *p = block;
+}
+
+void move_loop_invariants(Program *prog) {
+    for(Function *fn = prog->fns; fn; fn = fn->next) {
+        if(!should_run_pass("licm", fn))
+            continue;
+        caller = fn;
+        find_escaped();
+        for(Node **q = &fn->node; *q; q = &(*q)->next)
+            licm_node(q);
+    }
+}
+
+//
+// Loop vectorization
+//
+// A counted loop stepping by 1 whose body is one of
+//
+//   a[i] = b[i] + c[i];   a[i] = b[i] - c[i];
+//   a[i] = b[i] + k;      a[i] = b[i] - k;      a[i] = b[i];
+//   s = s + b[i];
+//
+// over char or int arrays is marked for codegen, which runs as many
+// iterations as it can 16 bytes at a time with SSE2 and leaves the rest
+// to the original loop. The arrays are named arrays or pointers held in
+// locals, so that the loop cannot change where they are. If a stored
+// array may overlap a loaded one, the overlap is checked at run time.
+//
+
+// Returns the base of `base[iv]`.
+static Node *match_elem(Node *node, Var *iv) {
+    if(node->kind != ND_DEREF || !is_integer(node->ty) ||
+       (node->ty->size != 1 && node->ty->size != 4))
+        return NULL;
+
+    Node *addr = node->lhs;
+    if(addr->kind != ND_PTR_ADD || !is_var(addr->rhs, iv))
+        return NULL;
+
+    Node *base = addr->lhs;
+    if(base->kind != ND_VAR)
+        return NULL;
+    if(base->var->ty->kind == TY_ARRAY)
+        return base;
+    if(base->var->ty->kind == TY_PTR && is_reg_var(base->var))
+        return base;
+    return NULL;
+}
+
+static bool is_scalar_operand(Node *node, Var *iv) {
+    if(node->kind == ND_NUM)
+        return true;
+    return node->kind == ND_VAR && node->var != iv && is_integer(node->ty) &&
+           is_reg_var(node->var);
+}
+
+// Returns true unless `a` and `b` are the same or distinct arrays.
+static bool may_overlap(Node *a, Node *b) {
+    if(a->var == b->var)
+        return false;
+    return a->var->ty->kind != TY_ARRAY || b->var->ty->kind != TY_ARRAY;
+}
+
+// Why the last loop given to match_vector() was not vectorized
+static char *vec_missed;
+
+static Vector *match_vector(Node *node) {
+    CountedLoop l;
+    vec_missed = "not a counted loop stepping by 1";
+    if(!match_counted_loop(node, &l) || l.step != 1)
+        return NULL;
+
+    vec_missed = "body is not a single assignment";
+    Node *stmt = node->then;
+    if(stmt->kind == ND_BLOCK) {
+        if(!stmt->body || stmt->body->next)
+            return NULL;
+        stmt = stmt->body;
+    }
+    if(stmt->kind != ND_EXPR_STMT || stmt->lhs->kind != ND_ASSIGN)
+        return NULL;
+    vec_missed = "unsupported operation or array access";
+    Node *lhs = stmt->lhs->lhs;
+    Node *rhs = stmt->lhs->rhs;
+
+    Vector *vec = alloc(MEM_OPT, sizeof(Vector));
+    vec->iv = node->cond->lhs;
+    vec->limit = l.limit;
+    vec->inclusive = (node->cond->kind == ND_LE);
+
+    if(lhs->kind == ND_VAR) {
+        // Sums of chars and ints are kept in 32-bit lanes.
+        Var *sum = lhs->var;
+        if(sum == l.var || !is_integer(sum->ty) || sum->ty->size != 4 || !is_reg_var(sum))
+            return NULL;
+        if(rhs->kind != ND_ADD || !is_var(rhs->lhs, sum) || !(vec->src1 = match_elem(rhs->rhs, l.var)))
+            return NULL;
+        vec->op = ND_ADD;
+        vec->ty = rhs->rhs->ty;
+        vec->sum = lhs;
+    } else {
+        if(!(vec->dst = match_elem(lhs, l.var)))
+            return NULL;
+        vec->ty = lhs->ty;
+
+        Node *src1 = rhs, *src2 = NULL;
+        vec->op = ND_NULL;
+        if(rhs->kind == ND_ADD || rhs->kind == ND_SUB) {
+            vec->op = rhs->kind;
+            src1 = rhs->lhs;
+            src2 = rhs->rhs;
+            if(rhs->kind == ND_ADD && is_scalar_operand(src1, l.var)) {
+                src1 = rhs->rhs;
+                src2 = rhs->lhs;
+            }
+        }
+
+        vec->src1 = match_elem(src1, l.var);
+        if(!vec->src1 || src1->ty->size != vec->ty->size)
+            return NULL;
+
+        if(src2 && is_scalar_operand(src2, l.var)) {
+            vec->scalar = src2;
+        } else if(src2) {
+            vec->src2 = match_elem(src2, l.var);
+            if(!vec->src2 || src2->ty->size != vec->ty->size)
+                return NULL;
+        }
+
+        vec->check_src1 = may_overlap(vec->dst, vec->src1);
+        vec->check_src2 = vec->src2 && may_overlap(vec->dst, vec->src2);
+    }
+
+    // Too short to fill a vector
+    vec_missed = "too few iterations";
+    if(l.start->kind == ND_NUM && l.limit->kind == ND_NUM &&
+       l.limit->val - l.start->val + vec->inclusive < 16 / vec->ty->size)
+        return NULL;
+    return vec;
+}
+
+static void vectorize_node(Node *node) {
+    if(!node)
+        return;
+
+    vectorize_node(node->lhs);
+    vectorize_node(node->rhs);
+    vectorize_node(node->cond);
+    vectorize_node(node->then);
+    vectorize_node(node->els);
+    vectorize_node(node->init);
+    vectorize_node(node->inc);
+    for(Node *n = node->body; n; n = n->next)
+        vectorize_node(n);
+    for(Node *n = node->args; n; n = n->next)
+        vectorize_node(n);
+
+    if(node->kind != ND_FOR)
+        return;
+    node->vec = match_vector(node);
+    if(node->vec)
+        remark("vectorize", node->tok, "loop vectorized (%d lanes)", 16 / node->vec->ty->size);
+    else
+        remark_missed("vectorize", node->tok, "loop not vectorized: %s", vec_missed);
+}
+
+void vectorize_loops(Program *prog) {
+    for(Function *fn = prog->fns; fn; fn = fn->next) {
+        if(!should_run_pass("vectorize", fn))
+            continue;
+        caller = fn;
+        find_escaped();
+        for(Node *node = fn->node; node; node = node->next)
+            vectorize_node(node);
+    }
+}
+
+//
+// Local common subexpression elimination
+//
+// Within straight-line code, a pure expression computed again while its
+// operands are unchanged reads a local that saved the first result:
+//
+//   x = t[i] * 2; y = t[i] + 1;  =>  x = (tmp = t[i]) * 2; y = tmp + 1;
+//
+// Every expression computed so far is available until it is killed:
+// assigning a local kills the expressions that read it, and a call or a
+// store to memory kills those that load from memory. Code that may not
+// run, like the right side of && or the branches of "if", can use the
+// expressions computed before it, but the ones first computed there are
+// forgotten after it.
+//
+
+typedef struct Value Value;
+struct Value {
+    Value *next;
+    Value *hash_next;
+    Node *expr;  // first computation
+    Var *var;    // local that saves it, once it is reused
+    bool killed;
+};
+
+static Value *values; // available expressions, innermost first
+
+// The same values by cse_hash. Values are added and dropped in stack
+// order, so the newest one is always at the head of its bucket.
+#define VALUE_TABLE_SIZE 1024
+static Value *value_table[VALUE_TABLE_SIZE];
+
+static Value **value_bucket(Node *expr) {
+    return &value_table[expr->cse_hash % VALUE_TABLE_SIZE];
+}
+
+static void push_value(Node *expr) {
+    Value *v = alloc(MEM_OPT, sizeof(Value));
+    v->expr = expr;
+    v->next = values;
+    values = v;
+    Value **bucket = value_bucket(expr);
+    v->hash_next = *bucket;
+    *bucket = v;
+}
+
+// Forgets the values computed since `saved`.
+static void restore_values(Value *saved) {
+    for(; values != saved; values = values->next)
+        *value_bucket(values->expr) = values->hash_next;
+}
+static int cse_count;  // computations removed in `caller`
+
+static bool reads_memory(Node *node, void *arg) {
+    if(node->kind == ND_DEREF)
+        return true;
+    return node->kind == ND_VAR && node->var->ty->kind != TY_ARRAY && !is_reg_var(node->var);
+}
+
+static bool is_costly(Node *node, void *arg) {
+    switch(node->kind) {
+    case ND_DEREF:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_PTR_DIFF:
+        return true;
+    }
+    return false;
+}
+
+// Sets cse_size and cse_costly of every node in the tree bottom-up, so
+// that checking a candidate does not walk its subtree again.
+static void set_cse_props(Node *node) {
+    if(!node)
+        return;
+
+    set_cse_props(node->lhs);
+    set_cse_props(node->rhs);
+    set_cse_props(node->cond);
+    set_cse_props(node->then);
+    set_cse_props(node->els);
+    set_cse_props(node->init);
+    set_cse_props(node->inc);
+    for(Node *n = node->body; n; n = n->next)
+        set_cse_props(n);
+    for(Node *n = node->args; n; n = n->next)
+        set_cse_props(n);
+
+    Node *l = node->lhs;
+    Node *r = node->rhs;
+    bool pure = is_pure_kind(node->kind) && (!l || l->cse_size) && (!r || r->cse_size);
+    node->cse_size = pure ? 1 + (l ? l->cse_size : 0) + (r ? r->cse_size : 0) : 0;
+    node->cse_costly = is_costly(node, NULL) || (l && l->cse_costly) || (r && r->cse_costly);
+
+    unsigned h = node->kind;
+    if(node->kind == ND_NUM)
+        h = h * 31 + node->val;
+    else if(node->kind == ND_VAR)
+        h = h * 31 + (unsigned)(long)node->var;
+    else if(node->kind == ND_MEMBER)
+        h = h * 31 + (unsigned)(long)node->member;
+    h = h * 31 + (l ? l->cse_hash : 0);
+    node->cse_hash = h * 31 + (r ? r->cse_hash : 0);
+}
+
+static bool is_cse_candidate(Node *node) {
+    if(!node->ty || (!is_integer(node->ty) && node->ty->kind != TY_PTR))
+        return false;
+
+    switch(node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+    case ND_ADDR:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_NOT:
+    case ND_LOGAND:
+    case ND_LOGOR:
+        return false;
+    case ND_PTR_ADD:
+    case ND_PTR_SUB:
+        // `p + i` folds into an addressing mode anyway.
+        if(node->rhs->kind == ND_VAR || node->rhs->kind == ND_NUM)
+            return false;
+    }
+
+    if(!node->cse_size)
+        return false;
+    return node->cse_costly || node->cse_size >= 5;
+}
+
+static bool reads_var(Node *node, void *var) {
+    return is_var(node, var);
+}
+
+static void kill_var(Var *var) {
+    for(Value *v = values; v; v = v->next)
+        if(find_node(v->expr, reads_var, var))
+            v->killed = true;
+}
+
+static void kill_memory(void) {
+    for(Value *v = values; v; v = v->next)
+        if(find_node(v->expr, reads_memory, NULL))
+            v->killed = true;
+}
+
+static bool kill_writes(Node *node, void *arg) {
+    if(node->kind == ND_FUNCALL) {
+        kill_memory();
+    } else if(node->kind == ND_ASSIGN) {
+        if(node->lhs->kind == ND_VAR && is_reg_var(node->lhs->var))
+            kill_var(node->lhs->var);
+        else
+            kill_memory();
+    }
+    return false;
+}
+
+// Makes `node` read the local that saves `v`, saving it first if `node`
+// is the first reuse.
+static void reuse_value(Value *v, Node *node) {
+    if(!v->var) {
+        Node *first = v->expr;
+        Node *expr = alloc(MEM_NODE, sizeof(Node));
+        *expr = *first;
+        expr->next = NULL;
+
+        v->var = new_temp(first->ty);
+        Node *next = first->next;
+        *first = *new_binary(ND_ASSIGN, new_var_node(v->var, first->tok), expr, first->tok);
+        first->next = next;
+        v->expr = expr;
+    }
+
+    replace_with_var(node, v->var);
+    cse_count++;
+    remark("cse", node->tok, "common subexpression reused");
+}
+
+static void cse(Node *node, bool lvalue);
+
+// Visits code that may not run.
+static void cse_maybe(Node *node) {
+    Value *saved = values;
+    cse(node, false);
+    restore_values(saved);
+}
+
+// `lvalue` tells if `node` is the object of an assignment or "&".
+static void cse(Node *node, bool lvalue) {
+    if(!node)
+        return;
+
+    bool candidate = !lvalue && is_cse_candidate(node);
+    if(candidate) {
+        for(Value *v = *value_bucket(node); v; v = v->hash_next) {
+            if(!v->killed && v->expr->cse_hash == node->cse_hash && same_expr(v->expr, node)) {
+                reuse_value(v, node);
+                return;
+            }
+        }
+    }
+
+    switch(node->kind) {
+    case ND_VAR:
+        return;
+    case ND_ASSIGN:
+        cse(node->lhs, true);
+        cse(node->rhs, false);
+        kill_writes(node, NULL);
+        return;
+    case ND_ADDR:
+    case ND_MEMBER:
+        cse(node->lhs, true);
+        break;
+    case ND_DEREF:
+        cse(node->lhs, false);
+        break;
+    case ND_FUNCALL:
+        for(Node *n = node->args; n; n = n->next)
+            cse(n, false);
+        kill_memory();
+        return;
+    case ND_LOGAND:
+    case ND_LOGOR:
+        cse(node->lhs, false);
+        cse_maybe(node->rhs);
+        return;
+    case ND_IF:
+        cse(node->cond, false);
+        cse_maybe(node->then);
+        cse_maybe(node->els);
+        return;
+    case ND_WHILE:
+    case ND_FOR: {
+        cse(node->init, false);
+
+        // The loop may come back around after anything in it.
+        find_node(node->cond, kill_writes, NULL);
+        find_node(node->then, kill_writes, NULL);
+        find_node(node->inc, kill_writes, NULL);
+
+        Value *saved = values;
+        cse(node->cond, false);
+        cse(node->then, false);
+        cse(node->inc, false);
+        restore_values(saved);
+        return;
+    }
+    case ND_STMT_EXPR:
+        // An inlined body may return from the middle.
+        if(node->inlined) {
+            Value *saved = values;
+            for(Node *n = node->body; n; n = n->next)
+                cse(n, false);
+            restore_values(saved);
+            return;
+        }
+        for(Node *n = node->body; n; n = n->next)
+            cse(n, false);
+        return;
+    default:
+        cse(node->lhs, false);
+        cse(node->rhs, false);
+        for(Node *n = node->body; n; n = n->next)
+            cse(n, false);
+        break;
+    }
+
+    if(candidate)
+        push_value(node);
+}
+
+typedef struct CseStat CseStat;
+struct CseStat {
+    CseStat *next;
+    char *name;
+    int count;
+};
+
+static CseStat *cse_stats;
+
+void eliminate_common_subexprs(Program *prog) {
+    CseStat head = {};
+    CseStat *cur = &head;
+
+    for(Function *fn = prog->fns; fn; fn = fn->next) {
+        caller = fn;
+        find_escaped();
+        cse_count = 0;
+        if(should_run_pass("cse", fn)) {
+            for(Node *node = fn->node; node; node = node->next)
+                set_cse_props(node);
+            for(Node *node = fn->node; node; node = node->next)
+                cse(node, false);
+            restore_values(NULL);
+        }
+
+        cur = cur->next = alloc(MEM_OPT, sizeof(CseStat));
+        cur->name = fn->name;
+        cur->count = cse_count;
+    }
+    cse_stats = head.next;
+}
+
+void print_cse_stats(void) {
+    int total = 0;
+    for(CseStat *s = cse_stats; s; s = s->next) {
+        fprintf(stderr, "cse: %-14s %d\n", s->name, s->count);
+        total += s->count;
+    }
+    fprintf(stderr, "cse: %-14s %d\n", "(total)", total);
+}
+
+//
+// Dead code elimination
+//
+// Removes code whose effect can never be observed: statements after a
+// "return", "if" and loops with constant conditions, expression
+// statements without side effects, and stores to locals that are never
+// read. Locals that are no longer used at all are dropped from the frame.
+// Functions that take the address of a local keep all their stores.
+//
+
+static bool dce_changed;
+
+// A set of variables is a mark value: a variable is in the set if its
+// `mark` equals it. Taking a new mark empties the set in O(1).
+static int last_mark;
+static int read_mark; // locals read in `caller`
+
+static int new_mark(void) {
+    return ++last_mark;
+}
+
+// Marks the variables that are read, or referenced at all if `stores`
+// is true, with `mark`.
+static void collect_vars(Node *node, int mark, bool stores) {
+    if(!node)
+        return;
+
+    if(node->kind == ND_VAR) {
+        node->var->mark = mark;
+        return;
+    }
+    if(!stores && node->kind == ND_ASSIGN && node->lhs->kind == ND_VAR) {
+        collect_vars(node->rhs, mark, stores);
+        return;
+    }
+
+    collect_vars(node->lhs, mark, stores);
+    collect_vars(node->rhs, mark, stores);
+    collect_vars(node->cond, mark, stores);
+    collect_vars(node->then, mark, stores);
+    collect_vars(node->els, mark, stores);
+    collect_vars(node->init, mark, stores);
+    collect_vars(node->inc, mark, stores);
+    for(Node *n = node->body; n; n = n->next)
+        collect_vars(n, mark, stores);
+    for(Node *n = node->args; n; n = n->next)
+        collect_vars(n, mark, stores);
+}
+
+static bool eval_const(Node *node, long *val) {
+    long l, r;
+
+    switch(node->kind) {
+    case ND_NUM:
+        *val = node->val;
+        return true;
+    case ND_NOT:
+        if(!eval_const(node->lhs, &l))
+            return false;
+        *val = !l;
+        return true;
+    case ND_LOGAND:
+    case ND_LOGOR:
+        if(!eval_const(node->lhs, &l))
+            return false;
+        // The right side is not evaluated if the left decides.
+        if((node->kind == ND_LOGAND) == !l) {
+            *val = !!l;
+            return true;
+        }
+        if(!eval_const(node->rhs, &r))
+            return false;
+        *val = !!r;
+        return true;
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        if(!eval_const(node->lhs, &l) || !eval_const(node->rhs, &r))
+            return false;
+        switch(node->kind) {
+        case ND_ADD: *val = l + r; return true;
+        case ND_SUB: *val = l - r; return true;
+        case ND_MUL: *val = l * r; return true;
+        case ND_DIV:
+            if(r == 0)
+                return false;
+            *val = l / r;
+            return true;
+        case ND_EQ: *val = l == r; return true;
+        case ND_NE: *val = l != r; return true;
+        case ND_LT: *val = l < r; return true;
+        case ND_LE: *val = l <= r; return true;
+        }
+    }
+    return false;
+}
+
+// Returns true if control never gets past `node`.
+static bool always_returns(Node *node) {
+    switch(node->kind) {
+    case ND_RETURN:
+        return true;
+    case ND_IF:
+        return node->els && always_returns(node->then) && always_returns(node->els);
+    case ND_BLOCK:
+        for(Node *n = node->body; n; n = n->next)
+            if(always_returns(n))
+                return true;
+        return false;
+    }
+    return false;
+}
+
+static bool is_empty(Node *node) {
+    return !node || node->kind == ND_NULL || (node->kind == ND_BLOCK && !node->body);
+}
+
+static bool is_useless(Node *node) {
+    return is_empty(node) || (node->kind == ND_EXPR_STMT && is_pure(node->lhs));
+}
+
+// Replaces the node at `*p` with `with`, or with an empty statement.
+// The parent is relinked rather than the node overwritten, since jumps
+// such as the returns of an inlined body refer to nodes by address.
+static void replace_node(Node **p, Node *with) {
+    if(!with)
+        with = new_node(ND_NULL, (*p)->tok);
+    with->next = (*p)->next;
+    *p = with;
+    dce_changed = true;
+}
+
+static void dce_list(Node **list, bool keep_last);
+
+static void dce(Node **p) {
+    Node *node = *p;
+    if(!node)
+        return;
+
+    switch(node->kind) {
+    case ND_BLOCK:
+        dce_list(&node->body, false);
+        return;
+    case ND_STMT_EXPR:
+        // The last expression is the value of a statement expression.
+        dce_list(&node->body, !node->inlined);
+        return;
+    }
+
+    dce(&node->lhs);
+    dce(&node->rhs);
+    dce(&node->cond);
+    dce(&node->then);
+    dce(&node->els);
+    dce(&node->init);
+    dce(&node->inc);
+    for(Node **arg = &node->args; *arg; arg = &(*arg)->next)
+        dce(arg);
+
+    long val;
+    switch(node->kind) {
+    case ND_ASSIGN:
+        // The value of `x = y` is that of y.
+        if(!escaped && node->lhs->kind == ND_VAR && is_reg_var(node->lhs->var) &&
+           node->lhs->var->mark != read_mark) {
+            remark("dce", node->tok, "dead store to '%s' removed", node->lhs->var->name);
+            replace_node(p, node->rhs);
+        }
+        return;
+    case ND_IF:
+        if(eval_const(node->cond, &val)) {
+            remark("dce", node->tok, "branch with constant condition removed");
+            replace_node(p, val ? node->then : node->els);
+        }
+        else if(is_empty(node->then) && is_empty(node->els) && is_pure(node->cond))
+            replace_node(p, NULL);
+        return;
+    case ND_WHILE:
+    case ND_FOR:
+        if(node->init && is_useless(node->init)) {
+            node->init = NULL;
+            dce_changed = true;
+        }
+        if(node->inc && is_useless(node->inc)) {
+            node->inc = NULL;
+            dce_changed = true;
+        }
+        if(node->cond && eval_const(node->cond, &val)) {
+            if(!val) {
+                replace_node(p, node->init);
+                return;
+            }
+            node->kind = ND_FOR;
+            node->cond = NULL;
+            dce_changed = true;
+        }
+        return;
+    }
+}
+
+static void dce_list(Node **list, bool keep_last) {
+    for(Node **p = list; *p;) {
+        dce(p);
+        Node *node = *p;
+
+        bool last = !node->next;
+        if(!(keep_last && last) && is_useless(node)) {
+            *p = node->next;
+            dce_changed = true;
+            continue;
+        }
+
+        if(!last && always_returns(node)) {
+            Node *rest = NULL;
+            if(keep_last)
+                for(rest = node->next; rest->next; rest = rest->next)
+                    ;
+            if(node->next != rest) {
+                remark("dce", node->next->tok, "unreachable code removed");
+                node->next = rest;
+                dce_changed = true;
+            }
+        }
+        p = &node->next;
+    }
+}
+
+void eliminate_dead_code(Program *prog) {
+    for(Function *fn = prog->fns; fn; fn = fn->next) {
+        if(!should_run_pass("dce", fn))
+            continue;
+        caller = fn;
+        find_escaped();
+
+        do {
+            dce_changed = false;
+            read_mark = new_mark();
+            for(Node *node = fn->node; node; node = node->next)
+                collect_vars(node, read_mark, false);
+            dce_list(&fn->node, false);
+        } while(dce_changed);
+
+        // Drop the locals that are no longer referenced. Pointer
+        // arithmetic on the address of one local may reach the others,
+        // so the frame is left alone if any address is taken.
+        if(escaped)
+            continue;
+        int used = new_mark();
+        for(Node *node = fn->node; node; node = node->next)
+            collect_vars(node, used, true);
+        for(VarList *vl = fn->params; vl; vl = vl->next)
+            vl->var->mark = used;
+        for(VarList **p = &fn->locals; *p;) {
+            if((*p)->var->mark != used)
+                *p = (*p)->next;
+            else
+                p = &(*p)->next;
+        }
+    }
+}
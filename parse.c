@@ -50,15 +50,24 @@ static void leave_scope(void) {
 // 連結リストから変数を名前で検索。見つからなかった場合はNULLを返す
 // scopeの内側から外側へ変数を辿る
 static Var *find_var(Token *tok) {
+    stats.lookups++;
+    long chain = 0;
+
     // 内側のscopeから変数を辿り、なければ、その外側のscopeというように変数を辿る
+    Var *var = NULL;
     for(VarScope *sc = var_scope; sc; sc = sc->next) {
+        chain++;
         if(strlen(sc->name) == tok->len && !strncmp(tok->str, sc->name, tok->len)) {
             // 変数名がリストから見つかったら、その位置のvar構造体のポインタを返す
-            return sc->var;
+            var = sc->var;
+            break;
         }
     }
 
-    return NULL;
+    stats.lookup_steps += chain;
+    if(chain > stats.max_lookup_chain)
+        stats.max_lookup_chain = chain;
+    return var;
 }
 
 static TagScope *find_tag(Token *tok) {
@@ -75,7 +84,8 @@ static TagScope *find_tag(Token *tok) {
 // - 左辺と右辺を受け取る2項演算子
 // - 数値
 static Node *new_node(NodeKind kind, Token *tok) {
-    Node *node = calloc(1, sizeof(Node));
+    Node *node = alloc(MEM_NODE, sizeof(Node));
+    stats.nodes++;
     node->kind = kind;
     node->tok = tok;
     return node;
@@ -109,7 +119,7 @@ static Node *new_node_num(long value, Token *tok) {
 
 // scopeインスタンスを作成して、リストにつなげる
 static VarScope *push_scope(char *name, Var *var) {
-    VarScope *sc = calloc(1, sizeof(VarScope));
+    VarScope *sc = alloc(MEM_SCOPE, sizeof(VarScope));
     sc->name = name;
     sc->var = var;
     sc->depth = scope_depth;
@@ -121,9 +131,9 @@ static VarScope *push_scope(char *name, Var *var) {
 }
 
 static TagScope *push_tag_scope(Token *tok, Type *ty) {
-    TagScope *tsc = calloc(1, sizeof(TagScope));
+    TagScope *tsc = alloc(MEM_SCOPE, sizeof(TagScope));
     tsc->next = tag_scope;
-    tsc->name = strndup(tok->str, tok->len);
+    tsc->name = alloc_strndup(MEM_STRING, tok->str, tok->len);
     tsc->ty = ty;
     tsc->depth = scope_depth;
     tag_scope = tsc;
@@ -133,7 +143,7 @@ static TagScope *push_tag_scope(Token *tok, Type *ty) {
 
 // 変数を作成
 static Var *new_var(char *name, Type *ty, bool is_local) {
-    Var *var = calloc(1, sizeof(Var));
+    Var *var = alloc(MEM_VAR, sizeof(Var));
     var->name = name;
     var->ty = ty;
     var->is_local = is_local;
@@ -150,7 +160,7 @@ static Var *new_lvar(char *name, Type *ty) {
     Var *var = new_var(name, ty, true);
 
     // ローカル変数と関数の引数を両方含んだ変数のリストを作成
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = alloc(MEM_VAR, sizeof(VarList));
     vl->var = var;
     vl->next = locals; // 関数内のローカル変数(または引数)のインスタンス(VarList構造体)を作成して今のlocalsリストにつなげる
     locals = vl; // locals変数が常にVarListの連結リストの先頭を指すようにする
@@ -162,7 +172,7 @@ static Var *new_lvar(char *name, Type *ty) {
 static Var *new_gvar(char *name, Type *ty) {
     Var *var = new_var(name, ty, false); // varはscopeに関連付けられ、リストに連結されていく
 
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = alloc(MEM_VAR, sizeof(VarList));
     vl->var = var;
     vl->next = globals;
     globals = vl;
@@ -170,13 +180,44 @@ static Var *new_gvar(char *name, Type *ty) {
     return var;
 }
 
+// String literals seen so far, hashed by their contents so that
+// identical literals share a single label.
+#define STR_HASH_SIZE 1024
+static VarList *str_literals[STR_HASH_SIZE];
+
+static unsigned int str_hash(char *s, int len) {
+    // FNV-1a
+    unsigned int h = 2166136261;
+    for(int i = 0; i < len; i++)
+        h = (h ^ (unsigned char)s[i]) * 16777619;
+    return h % STR_HASH_SIZE;
+}
+
+static Var *find_str_literal(Token *tok) {
+    VarList *vl = str_literals[str_hash(tok->contents, tok->cont_len)];
+    for(; vl; vl = vl->next) {
+        Var *var = vl->var;
+        if(var->cont_len == tok->cont_len && !memcmp(var->contents, tok->contents, tok->cont_len))
+            return var;
+    }
+    return NULL;
+}
+
+static void add_str_literal(Var *var) {
+    unsigned int h = str_hash(var->contents, var->cont_len);
+    VarList *vl = alloc(MEM_VAR, sizeof(VarList));
+    vl->var = var;
+    vl->next = str_literals[h];
+    str_literals[h] = vl;
+}
+
 // 今まで見た文字列リテラルがすべて入っているベクタ
 static char *new_label(void) {
     static int cnt = 0;
     char buf[20];
     sprintf(buf, ".L.data.%d", cnt++);
 
-    return strndup(buf, 20);
+    return alloc_strndup(MEM_STRING, buf, 20);
 }
 
 
@@ -197,6 +238,8 @@ static Node *stmt(void);
 static Node *stmt2(void);
 static Node *expr(void);
 static Node *assign(void);
+static Node *logor(void);
+static Node *logand(void);
 static Node *equality(void);
 static Node *relational(void);
 static Node *add(void);
@@ -216,6 +259,8 @@ static Node *primary(void);
 static bool is_function(void) {
     Token *tok = token;
 
+    while(consume("static") || consume("inline"))
+        ;
     Type *ty = basetype();
     char *name = NULL;
     declarator(ty, &name);
@@ -261,7 +306,7 @@ Program *program(void) {
         global_var();
     }
 
-    Program *prog = calloc(1, sizeof(Program));
+    Program *prog = alloc(MEM_OTHER, sizeof(Program));
     prog->globals = globals;
     prog->fns = head.next;
 
@@ -306,7 +351,7 @@ static Type *declarator(Type *ty, char **name) {
         ty = pointer_to(ty);
 
     if(consume("(")) {
-        Type *placeholder = calloc(1, sizeof(Type));
+        Type *placeholder = alloc(MEM_TYPE, sizeof(Type));
         Type *new_ty = declarator(placeholder, name);
         expect(")");
         memcpy(placeholder, type_suffix(ty), sizeof(Type));
@@ -361,7 +406,7 @@ static Type *struct_decl(void) {
     }
 
     // Construct a struct object.
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = alloc(MEM_TYPE, sizeof(Type));
     ty->kind = TY_STRUCT;
     ty->members = head.next;
 
@@ -407,7 +452,7 @@ static Type *union_decl(void) {
         cur = cur->next;
     }
  
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = alloc(MEM_TYPE, sizeof(Type));
     ty->kind = TY_STRUCT;
     ty->members = head.next;
 
@@ -438,7 +483,7 @@ static Member *struct_member(void) {
     expect(";");
 
     // memberインスタンスを作成
-    Member *mem = calloc(1, sizeof(Member));
+    Member *mem = alloc(MEM_TYPE, sizeof(Member));
     mem->name = name;
     mem->ty = ty;
     return mem;
@@ -450,7 +495,7 @@ static VarList *read_func_param(void) {
     ty = declarator(ty, &name);
     ty = type_suffix(ty);
 
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = alloc(MEM_VAR, sizeof(VarList));
     vl->var = new_lvar(name, ty); // localsリストを更新しつつ、新しいVarインスタンスを返す
     return vl;
 }
@@ -472,7 +517,7 @@ static VarList *read_func_params(void) {
     return head;
 }
 
-// function = basetype declarator "(" params? ")" ("{" stmt* "}" | ";")
+// function = ("static" | "inline")* basetype declarator "(" params? ")" ("{" stmt* "}" | ";")
 // params   = param ("," param)*
 // param    = basetype declarator type-suffix
 // e.g.
@@ -481,8 +526,20 @@ static VarList *read_func_params(void) {
 static Function *function() {
     locals = NULL;
 
+    bool is_static = false;
+    bool is_inline = false;
+    for(;;) {
+        if(consume("static"))
+            is_static = true;
+        else if(consume("inline"))
+            is_inline = true;
+        else
+            break;
+    }
+
     Type *ty = basetype(); // basetypeを作成(関数の返り値の型)
     char *name = NULL;
+    Token *tok = token;
     ty = declarator(ty, &name); // この関数内でnameが設定される
 
     // 関数の戻り値の型を、scopeに繋げる
@@ -491,8 +548,11 @@ static Function *function() {
     new_var(name, func_type(ty), false);
 
     // Construct a function body
-    Function *fn = calloc(1, sizeof(Function));
+    Function *fn = alloc(MEM_OTHER, sizeof(Function));
     fn->name = name;
+    fn->tok = tok;
+    fn->is_static = is_static;
+    fn->is_inline = is_inline;
     expect("(");
 
     enter_scope();
@@ -688,9 +748,9 @@ static Node *expr(void) {
     return node;
 }
 
-// assign = equality ("=" assign)?
+// assign = logor ("=" assign)?
 static Node *assign(void) {
-    Node *node = equality();
+    Node *node = logor();
     Token *tok;
 
     if(tok = consume("="))
@@ -699,6 +759,28 @@ static Node *assign(void) {
     return node;
 }
 
+// logor = logand ("||" logand)*
+static Node *logor(void) {
+    Node *node = logand();
+    Token *tok;
+
+    while(tok = consume("||"))
+        node = new_binary(ND_LOGOR, node, logand(), tok);
+
+    return node;
+}
+
+// logand = equality ("&&" equality)*
+static Node *logand(void) {
+    Node *node = equality();
+    Token *tok;
+
+    while(tok = consume("&&"))
+        node = new_binary(ND_LOGAND, node, equality(), tok);
+
+    return node;
+}
+
 // equality = relational ("==" relational | "!=" relational)*
 static Node *equality(void) {
     Node *node = relational();
@@ -812,7 +894,7 @@ static Node *mul(void) {
 }
 
 // unary: 単項
-// unary = ("+" | "-" | "&" | "*")? unary | postfix
+// unary = ("+" | "-" | "&" | "*" | "!")? unary | postfix
 static Node *unary(void) {
     Token *tok;
     if(consume("+")) {
@@ -827,6 +909,8 @@ static Node *unary(void) {
         return new_unary(ND_ADDR, unary(), tok);
     if(tok = consume("*"))
         return new_unary(ND_DEREF, unary(), tok);
+    if(tok = consume("!"))
+        return new_unary(ND_NOT, unary(), tok);
 
     return postfix();
 }
@@ -1007,7 +1091,7 @@ static Node *primary(void) {
         // Function call
         if(consume("(")) {
             Node *node = new_node(ND_FUNCALL, tok);
-            node->funcname = strndup(tok->str, tok->len);
+            node->funcname = alloc_strndup(MEM_STRING, tok->str, tok->len);
             node->args = func_args();
             add_type(node);
 
@@ -1043,12 +1127,18 @@ static Node *primary(void) {
     if(tok->kind == TK_STR) {
         token = token->next;
 
+        // Identical literals are pooled into one global.
+        Var *var = find_str_literal(tok);
+        if(var)
+            return new_node_var(var, tok);
+
         Type *ty = array_of(char_type, tok->cont_len); // base type はchar型, 長さは文字列の長さ分
-        Var *var = new_gvar(new_label(), ty); // nameは型はarray
+        var = new_gvar(new_label(), ty); // nameは型はarray
         // new_gvar()のなかで、varはvar_scopeに関連づけられ、さらにVarList globalsに連結される
 
         var->contents = tok->contents;
         var->cont_len = tok->cont_len;
+        add_str_literal(var);
 
         return new_node_var(var, tok);
     }
@@ -0,0 +1,109 @@
+#include "9cc.h"
+#include <regex.h>
+
+// Pass manager
+//
+// The optimization passes run over the whole program in a fixed order.
+// A pass runs if its gate says so, which depends on the -O level and
+// the -f flags. Within a pass, every function is numbered for
+// -opt-bisect-limit=N, whether or not the pass would change it, as in
+// LLVM. All but the first N (pass, function) pairs are skipped so that
+// a miscompile can be bisected to one pass on one function.
+
+static bool gate_inline(void) { return opt_inline; }
+static bool gate_vectorize(void) { return opt_tree_vectorize; }
+static bool gate_unroll(void) { return opt_peel_loops || opt_unroll_loops; }
+static bool gate_licm(void) { return opt_move_loop_invariants || opt_ivopts; }
+static bool gate_cse(void) { return opt_cse; }
+static bool gate_dce(void) { return opt_dce; }
+
+typedef struct {
+    char *name;
+    TimeVar tv;
+    bool (*gate)(void);
+    void (*run)(Program *prog);
+} Pass;
+
+static Pass passes[] = {
+    // Replace calls to small functions with their bodies. This adds
+    // locals to the callers, so it comes before the frame layout.
+    {"inline", TV_INLINE, gate_inline, inline_functions},
+    // Before the loops are unrolled or their indexing strength-reduced
+    {"vectorize", TV_VECTORIZE, gate_vectorize, vectorize_loops},
+    {"unroll", TV_UNROLL, gate_unroll, unroll_loops},
+    {"licm", TV_LICM, gate_licm, move_loop_invariants},
+    {"cse", TV_CSE, gate_cse, eliminate_common_subexprs},
+    {"dce", TV_DCE, gate_dce, eliminate_dead_code},
+};
+
+int opt_bisect_limit = -1;
+static int bisect_count;
+
+void run_passes(Program *prog) {
+    for(int i = 0; i < sizeof(passes) / sizeof(*passes); i++) {
+        Pass *pass = &passes[i];
+        if(!pass->gate())
+            continue;
+        timevar_push(pass->tv);
+        pass->run(prog);
+        timevar_pop(pass->tv);
+    }
+}
+
+// Returns true if `pass` may change `fn`.
+bool should_run_pass(char *pass, Function *fn) {
+    if(opt_bisect_limit < 0)
+        return true;
+    bool run = ++bisect_count <= opt_bisect_limit;
+    fprintf(stderr, "BISECT: %s pass (%d) %s on function (%s)\n",
+            run ? "running" : "NOT running", bisect_count, pass, fn->name);
+    return run;
+}
+
+//
+// Optimization remarks
+//
+// -Rpass=<regex> reports what the passes whose names match did, and
+// -Rpass-missed=<regex> what they considered but did not do, e.g.
+//
+//   foo.c:10:5: remark: 'add' inlined into 'main' (size 6) [-Rpass=inline]
+//
+
+static regex_t *pass_re;
+static regex_t *missed_re;
+
+static regex_t *compile(char *pattern) {
+    regex_t *re = alloc(MEM_OTHER, sizeof(regex_t));
+    if(regcomp(re, pattern, REG_EXTENDED | REG_NOSUB))
+        error("invalid regular expression: %s", pattern);
+    return re;
+}
+
+void set_remark_filter(bool missed, char *pattern) {
+    if(missed)
+        missed_re = compile(pattern);
+    else
+        pass_re = compile(pattern);
+}
+
+static bool match(regex_t *re, char *pass) {
+    return re && !regexec(re, pass, 0, NULL, 0);
+}
+
+void remark(char *pass, Token *tok, char *fmt, ...) {
+    if(!match(pass_re, pass))
+        return;
+    va_list ap;
+    va_start(ap, fmt);
+    remark_tok(tok, "-Rpass", pass, fmt, ap);
+    va_end(ap);
+}
+
+void remark_missed(char *pass, Token *tok, char *fmt, ...) {
+    if(!match(missed_re, pass))
+        return;
+    va_list ap;
+    va_start(ap, fmt);
+    remark_tok(tok, "-Rpass-missed", pass, fmt, ap);
+    va_end(ap);
+}
@@ -0,0 +1,132 @@
+#include "9cc.h"
+
+// Profile-guided optimization
+//
+// With -fprofile-generate, every "if", loop and function call gets
+// counters which the compiled program increments as it runs and writes
+// to a profile file when it exits. With -fprofile-use, the counts are
+// read back to lay out branches and to choose which calls to inline.
+//
+// "if":   executions, times "then" was taken
+// loops:  executions, iterations
+// calls:  calls
+//
+// Counters are numbered right after parsing, before any optimization
+// changes the tree, so that both compilations agree on the numbering.
+// Copies of a node made by inlining or unrolling share its counters.
+
+int profile_size;           // number of counters
+unsigned profile_checksum;  // hash of the numbered node kinds
+
+static long *counts;        // counts read by -fprofile-use
+static long max_calls;      // count of the hottest call
+
+static void number_node(Node *node) {
+    if(!node)
+        return;
+
+    switch(node->kind) {
+    case ND_IF:
+    case ND_WHILE:
+    case ND_FOR:
+        node->prof_id = profile_size + 1;
+        profile_size += 2;
+        profile_checksum = profile_checksum * 31 + node->kind;
+        break;
+    case ND_FUNCALL:
+        node->prof_id = profile_size + 1;
+        profile_size += 1;
+        profile_checksum = profile_checksum * 31 + node->kind;
+        break;
+    }
+
+    number_node(node->lhs);
+    number_node(node->rhs);
+    number_node(node->cond);
+    number_node(node->then);
+    number_node(node->els);
+    number_node(node->init);
+    number_node(node->inc);
+    for(Node *n = node->body; n; n = n->next)
+        number_node(n);
+    for(Node *n = node->args; n; n = n->next)
+        number_node(n);
+}
+
+void number_profile_points(Program *prog) {
+    for(Function *fn = prog->fns; fn; fn = fn->next)
+        for(Node *node = fn->node; node; node = node->next)
+            number_node(node);
+}
+
+// Returns counter `k` of `node`, or -1 if there is no profile for it.
+long profile_count(Node *node, int k) {
+    if(!counts || !node->prof_id)
+        return -1;
+    return counts[node->prof_id - 1 + k];
+}
+
+static void find_max_calls(Node *node) {
+    if(!node)
+        return;
+    if(node->kind == ND_FUNCALL && profile_count(node, 0) > max_calls)
+        max_calls = profile_count(node, 0);
+
+    find_max_calls(node->lhs);
+    find_max_calls(node->rhs);
+    find_max_calls(node->cond);
+    find_max_calls(node->then);
+    find_max_calls(node->els);
+    find_max_calls(node->init);
+    find_max_calls(node->inc);
+    for(Node *n = node->body; n; n = n->next)
+        find_max_calls(n);
+    for(Node *n = node->args; n; n = n->next)
+        find_max_calls(n);
+}
+
+// Reads the counts written by a program compiled with -fprofile-generate.
+// A missing or stale profile is ignored with a warning.
+void read_profile(Program *prog, char *path) {
+    FILE *fp = fopen(path, "r");
+    if(!fp) {
+        fprintf(stderr, "warning: %s: no profile data: %s\n", path, strerror(errno));
+        return;
+    }
+
+    int n;
+    unsigned checksum;
+    if(fscanf(fp, "9cc-profile %d %u", &n, &checksum) != 2 ||
+       n != profile_size || checksum != profile_checksum) {
+        fprintf(stderr, "warning: %s: profile does not match the source\n", path);
+        fclose(fp);
+        return;
+    }
+
+    long *buf = alloc(MEM_OTHER, (n + 1) * sizeof(long));
+    for(int i = 0; i < n; i++) {
+        if(fscanf(fp, "%ld", &buf[i]) != 1) {
+            fprintf(stderr, "warning: %s: truncated profile\n", path);
+            fclose(fp);
+            return;
+        }
+    }
+    fclose(fp);
+    counts = buf;
+
+    for(Function *fn = prog->fns; fn; fn = fn->next)
+        for(Node *node = fn->node; node; node = node->next)
+            find_max_calls(node);
+}
+
+// A call is hot if it runs at least 1/8 as often as the hottest one.
+bool is_hot_call(Node *node) {
+    long n = profile_count(node, 0);
+    return n > 0 && n * 8 >= max_calls;
+}
+
+// Code is cold if it never ran, or ran less than 1/16 as often as the
+// statement around it which did run.
+bool is_cold(long count, long total) {
+    return count >= 0 && total > 0 && count * 16 < total;
+}
@@ -0,0 +1,108 @@
+#include "9cc.h"
+
+// Stack usage analysis for -fstack-usage and -Wframe-larger-than
+//
+// Codegen records for each function how many bytes it keeps below its
+// caller's rsp (return address, frame and deepest expression stack) and
+// how much of that is in use at each call. The worst case of a function
+// is then the largest of its own usage and, for every call, the stack
+// in use at the call plus the worst case of the callee.
+//
+// Recursion makes the worst case unbounded. Calls to functions that are
+// not defined in this file count as using no stack.
+
+typedef struct {
+    Function *fn;
+    int state;       // 0: not visited, 1: being visited, 2: done
+    int worst;
+    bool recursive;  // can reach a cycle of calls
+    bool external;   // can reach a function not defined here
+} StackInfo;
+
+static StackInfo *info;
+static int num_fns;
+
+static StackInfo *find_info(char *name) {
+    for(int i = 0; i < num_fns; i++)
+        if(!strcmp(info[i].fn->name, name))
+            return &info[i];
+    return NULL;
+}
+
+static void visit(StackInfo *si) {
+    if(si->state == 2)
+        return;
+    si->state = 1;
+
+    Function *fn = si->fn;
+    si->worst = fn->frame_bytes + fn->push_bytes;
+    for(CallSite *cs = fn->calls; cs; cs = cs->next) {
+        StackInfo *callee = find_info(cs->name);
+        if(!callee) {
+            si->external = true;
+            continue;
+        }
+        if(callee->state == 1) {
+            si->recursive = true;
+            continue;
+        }
+        visit(callee);
+        si->recursive |= callee->recursive;
+        si->external |= callee->external;
+        if(si->worst < cs->stack_bytes + callee->worst)
+            si->worst = cs->stack_bytes + callee->worst;
+    }
+    si->state = 2;
+}
+
+// Writes a line per function in the format of GCC's .su files with the
+// frame, expression stack and worst case through calls appended:
+//
+// foo.c:3:1:main	48	static	frame=32	push=16	max=112
+static void write_stack_usage(char *path, char *input_path) {
+    FILE *fp = fopen(path, "w");
+    if(!fp)
+        error("cannot open %s: %s", path, strerror(errno));
+
+    for(int i = 0; i < num_fns; i++) {
+        StackInfo *si = &info[i];
+        Function *fn = si->fn;
+        fprintf(fp, "%s:%d:%d:%s\t%d\tstatic\tframe=%d\tpush=%d\t", input_path,
+                fn->tok->line_no, fn->tok->col_no, fn->name,
+                fn->frame_bytes + fn->push_bytes, fn->frame_bytes, fn->push_bytes);
+        if(si->recursive)
+            fprintf(fp, "max=unbounded (recursive)");
+        else
+            fprintf(fp, "max=%d", si->worst);
+        if(si->external)
+            fprintf(fp, " +external");
+        fprintf(fp, "\n");
+    }
+    fclose(fp);
+}
+
+void report_stack_usage(Program *prog, char *input_path) {
+    num_fns = 0;
+    for(Function *fn = prog->fns; fn; fn = fn->next)
+        num_fns++;
+    info = alloc(MEM_OTHER, num_fns * sizeof(StackInfo));
+    int i = 0;
+    for(Function *fn = prog->fns; fn; fn = fn->next)
+        info[i++].fn = fn;
+
+    for(i = 0; i < num_fns; i++)
+        visit(&info[i]);
+
+    if(opt_frame_larger_than >= 0) {
+        for(i = 0; i < num_fns; i++) {
+            Function *fn = info[i].fn;
+            int size = fn->frame_bytes + fn->push_bytes;
+            if(size > opt_frame_larger_than)
+                warn_tok(fn->tok, "stack frame of %s is %d bytes, larger than %d bytes",
+                         fn->name, size, opt_frame_larger_than);
+        }
+    }
+
+    if(opt_stack_usage)
+        write_stack_usage(opt_stack_usage_path, input_path);
+}
@@ -0,0 +1,58 @@
+#!/bin/bash
+#
+# Checks the integrated assembler against GNU as
+#
+# usage: tests/asm-check.sh [9cc flags...] <file>
+#
+# Compiles <file> once with -c and once to assembly that as turns into
+# an object, then compares the two objects: the sections with their
+# sizes, alignment and flags, the bytes of code, read-only data,
+# .eh_frame and .debug_line, the relocations (but not the numbering of
+# the symbols they refer to) and the symbols. The
+# .debug_info that as writes has more in it than the one of -c, so it
+# and its companion sections are left out.
+
+AS=${AS:-as}
+
+tmp=$(mktemp -d)
+trap 'rm -rf $tmp' EXIT
+
+./9cc "$@" -c -o $tmp/c.o 2> $tmp/err || { cat $tmp/err; exit 1; }
+./9cc "$@" -o $tmp/as.s 2> /dev/null || exit 1
+$AS -o $tmp/as.o $tmp/as.s || exit 1
+
+SKIP='\.debug_(info|abbrev|aranges|str)'
+
+# Prints what is compared of object $1.
+dump() {
+    echo "== sections"
+    objdump -h $1 | awk '/^ *[0-9]+ / { name = $2; size = $3; align = $7; getline; print name, size, align, $0 }' |
+        grep -vE "$SKIP" | tr -s ' '
+
+    for sec in $(readelf -SW $1 | sed -n 's/^ *\[ *[0-9]*\] \([^ ]*\) .*/\1/p'); do
+        case $sec in
+        .text|.rodata*|.data|.fini_array|.eh_frame|.debug_line)
+            echo "== $sec"
+            readelf -x $sec $1 | grep '^  0x'
+            ;;
+        .rela*)
+            echo "$sec" | grep -qE "$SKIP" && continue
+            echo "== $sec"
+            readelf -rW $1 | awk -v sec="'$sec'" '
+                /^Relocation section/ { on = ($3 == sec); next }
+                on && NF { $2 = ""; print }' | tr -s ' '
+            ;;
+        esac
+    done
+
+    echo "== symbols"
+    objdump -t $1 | awk 'NR > 4 && NF && $0 !~ / d  / { $1 = $1; print }' | grep -vE "$SKIP" | sort
+}
+
+dump $tmp/as.o > $tmp/as.txt
+dump $tmp/c.o > $tmp/c.txt
+if ! diff -u $tmp/as.txt $tmp/c.txt > $tmp/diff; then
+    echo "asm-check: $* differs from $AS:"
+    head -50 $tmp/diff
+    exit 1
+fi
@@ -1 +1,9 @@
-int char_fn() { return 257; }
\ No newline at end of file
+#include <execinfo.h>
+
+int char_fn() { return 257; }
+
+// Returns 1 if the stack can be unwound from here through main.
+int unwind_ok() {
+    void *frames[64];
+    return backtrace(frames, 64) >= 3;
+}
@@ -68,7 +68,194 @@ int *g1_ptr() {
     return &g1;
 }
 
+int vec_add(int *p, int *q, int *r, int n) {
+    int i;
+    for (i = 0; i < n; i = i + 1)
+        p[i] = q[i] + r[i];
+    return i;
+}
+
+int dead_code(int x) {
+    int y;
+    int z;
+    y = x * 2;
+    z = 7;
+    x;
+    if (1 < 0)
+        return 1;
+    while (0)
+        x = 5;
+    return y + 1;
+    return z;
+}
+
+int bump(int *p) {
+    *p = *p + 1;
+    return 0;
+}
+
+int early_ret(int x) {
+    int y = 2;
+    return y + ({ if (x) return 5; 3; });
+}
+
+static int abs_int(int a) {
+    if(a < 0)
+        return 0 - a;
+    return a;
+}
+
+inline int max2(int a, int b) {
+    if(a < b)
+        return b;
+    return a;
+}
+
+long sum_to(long n, long acc) {
+    if(n == 0)
+        return acc;
+    return sum_to(n - 1, acc + n);
+}
+
+int is_odd(int n);
+int is_even(int n) {
+    if(n == 0)
+        return 1;
+    return is_odd(n - 1);
+}
+int is_odd(int n) {
+    if(n == 0)
+        return 0;
+    return is_even(n - 1);
+}
+
+int tail_in_expr(int x) {
+    int y = x * 2;
+    return 1 + ({ if(x > 100) return add2(x, y); 0; });
+}
+
+// A self tail call in a condition
+int tail_in_cond(int n) {
+    if(({ if(n > 0) return tail_in_cond(n - 1); 0; }))
+        return 7;
+    return 3;
+}
+
+int unwind_ok();
+
+// The value of && is kept on the stack across a call that unwinds.
+int kept_and(int a, int b) {
+    int y;
+    y = (a && b) + unwind_ok();
+    return y;
+}
+
+int kept_or(int a, int b) {
+    int y;
+    y = (a || b) + unwind_ok();
+    return y;
+}
+
+int pick(int a) {
+    if(a)
+        return 1;
+    return 2;
+}
+
+// The store is dead but the inlined call stays.
+int dead_inline_store() {
+    int y;
+    y = pick(3);
+    return 4;
+}
+
 int main() {
+    // vectorized loops
+    assert(1123, ({ int x[10]; int y[10]; int i; for(i=0; i<10; i=i+1) x[i]=i; for(i=0; i<10; i=i+1) y[i]=x[i]+3; y[0]+y[9]*10+i*100; }), "({ int x[10]; int y[10]; int i; for(i=0; i<10; i=i+1) x[i]=i; for(i=0; i<10; i=i+1) y[i]=x[i]+3; y[0]+y[9]*10+i*100; })");
+    assert(0-171, ({ char x[20]; int i; int s=0; for(i=0; i<20; i=i+1) x[i]=0-i; for(i=0; i<19; i=i+1) s=s+x[i]; s; }), "({ char x[20]; int i; int s=0; for(i=0; i<20; i=i+1) x[i]=0-i; for(i=0; i<19; i=i+1) s=s+x[i]; s; })");
+    assert(14, ({ char x[17]; char y[17]; int i; for(i=0; i<17; i=i+1) x[i]=i; for(i=0; i<17; i=i+1) y[i]=x[i]-1; y[16]+y[0]; }), "({ char x[17]; char y[17]; int i; for(i=0; i<17; i=i+1) x[i]=i; for(i=0; i<17; i=i+1) y[i]=x[i]-1; y[16]+y[0]; })");
+    assert(1024, ({ int x[12]; int i; for(i=0; i<12; i=i+1) x[i]=1; vec_add(x+1, x, x, 10); x[10]; }), "({ int x[12]; int i; for(i=0; i<12; i=i+1) x[i]=1; vec_add(x+1, x, x, 10); x[10]; })");
+    assert(22, ({ int x[12]; int i; for(i=0; i<12; i=i+1) x[i]=i; vec_add(x, x+4, x+4, 8)+x[3]; }), "({ int x[12]; int i; for(i=0; i<12; i=i+1) x[i]=i; vec_add(x, x+4, x+4, 8)+x[3]; })");
+    // dead code
+    assert(13, dead_code(6), "dead_code(6)");
+    assert(1, ({ int x=1; if(0) x=2; x; }), "({ int x=1; if(0) x=2; x; })");
+    assert(3, ({ int x=2; if(1<2) x=3; else x=4; x; }), "({ int x=2; if(1<2) x=3; else x=4; x; })");
+    assert(1, ({ int x=1; while(0) x=2; x; }), "({ int x=1; while(0) x=2; x; })");
+    assert(7, ({ int x=1; for(x=7; 0;) x=2; x; }), "({ int x=1; for(x=7; 0;) x=2; x; })");
+    // common subexpressions
+    assert(37, ({ int x[4]; x[2]=6; int i=2; int a=x[i]*3; int b=x[i]*3+1; a+b; }), "({ int x[4]; x[2]=6; int i=2; int a=x[i]*3; int b=x[i]*3+1; a+b; })");
+    assert(18, ({ int x[2]; x[0]=4; int i=0; int a=x[i]*2; x[0]=5; a+x[i]*2; }), "({ int x[2]; x[0]=4; int i=0; int a=x[i]*2; x[0]=5; a+x[i]*2; })");
+    assert(49, ({ int x[1]; x[0]=2; int a=x[0]*x[0]; bump(x); a*10+x[0]*x[0]; }), "({ int x[1]; x[0]=2; int a=x[0]*x[0]; bump(x); a*10+x[0]*x[0]; })");
+    assert(12, ({ int i=1; int j=2; int a=i*j; i=5; a+i*j; }), "({ int i=1; int j=2; int a=i*j; i=5; a+i*j; })");
+    assert(12, ({ int i=3; int j=4; int a=0; if(i>5) a=i*j; a+i*j; }), "({ int i=3; int j=4; int a=0; if(i>5) a=i*j; a+i*j; })");
+    assert(4, ({ int i=0; int j=4; (i && i*j) + (i+1)*j; }), "({ int i=0; int j=4; (i && i*j) + (i+1)*j; })");
+    // loop-invariant code motion and pointer induction variables
+    assert(168, ({ int x[4]; x[0]=3; x[1]=5; x[2]=7; x[3]=9; int i=0; int k=2; int s=0; while(i<4) { s=s+x[i]*x[k]; i=i+1; } s; }), "({ int x[4]; x[0]=3; x[1]=5; x[2]=7; x[3]=9; int i=0; int k=2; int s=0; while(i<4) { s=s+x[i]*x[k]; i=i+1; } s; })");
+    assert(6, ({ int x[3]; x[0]=1; x[1]=2; x[2]=3; int i=0; int s=0; while(i<3) { s=s+x[0]; x[0]=x[0]+1; i=i+1; } s; }), "({ int x[3]; x[0]=1; x[1]=2; x[2]=3; int i=0; int s=0; while(i<3) { s=s+x[0]; x[0]=x[0]+1; i=i+1; } s; })");
+    assert(0, ({ int *p=0; int i=0; int s=0; while(i<0) { s=s+*p; i=i+1; } s; }), "({ int *p=0; int i=0; int s=0; while(i<0) { s=s+*p; i=i+1; } s; })");
+    assert(9, ({ int x[6]; int i; for(i=0; i<6; i=i+1) x[i]=i; int s=0; i=1; while(i<6) { s=s+x[i]; i=i+2; } s; }), "({ int x[6]; int i; for(i=0; i<6; i=i+1) x[i]=i; int s=0; i=1; while(i<6) { s=s+x[i]; i=i+2; } s; })");
+    // rotated and unrolled loops
+    assert(105, ({ int i; int s=0; for(i=0; i<5; i=i+1) s=s+i; s*10+i; }), "({ int i; int s=0; for(i=0; i<5; i=i+1) s=s+i; s*10+i; })");
+    assert(66, ({ int i; int n=11; int s=0; for(i=0; i<n; i=i+1) s=s+i; s+i; }), "({ int i; int n=11; int s=0; for(i=0; i<n; i=i+1) s=s+i; s+i; })");
+    assert(2213, ({ int i; int n=10; int s=0; for(i=1; i<=n; i=i+3) s=s+i; s*100+i; }), "({ int i; int n=10; int s=0; for(i=1; i<=n; i=i+3) s=s+i; s*100+i; })");
+    assert(0, ({ int i; int n=0; int s=0; for(i=0; i<n; i=i+1) s=s+1; s+i; }), "({ int i; int n=0; int s=0; for(i=0; i<n; i=i+1) s=s+1; s+i; })");
+    // tail calls
+    assert(50005000, sum_to(10000, 0), "sum_to(10000, 0)");
+    assert(1, is_odd(100001), "is_odd(100001)");
+    assert(600, tail_in_expr(200), "tail_in_expr(200)");
+    assert(1, tail_in_expr(3), "tail_in_expr(3)");
+    // inlined calls
+    assert(5, abs_int(0-5), "abs_int(0-5)");
+    assert(12, 1 + (2 + max2(9, ret3())), "1 + (2 + max2(9, ret3()))");
+    assert(10, ({ int i; int s=0; for(i=0-4; i<0; i=i+1) s=s+abs_int(i); s; }), "({ int i; int s=0; for(i=0-4; i<0; i=i+1) s=s+abs_int(i); s; })");
+    // return from inside an expression
+    assert(5, early_ret(0), "early_ret(0)");
+    assert(4, dead_inline_store(), "dead_inline_store()");
+    assert(3, tail_in_cond(5), "tail_in_cond(5)");
+    assert(1, ({ char c; c = 0; c = c + 1000; c == 0-24; }), "({ char c; c = 0; c = c + 1000; c == 0-24; })");
+    assert(2, kept_and(1, 2), "kept_and(1, 2)");
+    assert(1, kept_and(1, 0), "kept_and(1, 0)");
+    assert(2, kept_or(0, 3), "kept_or(0, 3)");
+    assert(1, kept_or(0, 0), "kept_or(0, 0)");
+    assert(5, early_ret(1) + early_ret(1) - 5, "early_ret(1) + early_ret(1) - 5");
+    // aligned globals in .bss
+    assert(0, ({ long a = g2; a - a/16*16; }), "({ long a = g2; a - a/16*16; })");
+    assert(0, ({ long a = &g1; a - a/4*4; }), "({ long a = &g1; a - a/4*4; })");
+    // pooled string literals
+    assert(1, ({ char *a = "pool"; char *b = "pool"; a == b; }), "({ char *a = \"pool\"; char *b = \"pool\"; a == b; })");
+    assert(111, ({ char *a = "a suffix pool"; char *b = "pool"; b[1]; }), "({ char *a = \"a suffix pool\"; char *b = \"pool\"; b[1]; })");
+    assert(0, ({ char *b = "ool"; b[3]; }), "({ char *b = \"ool\"; b[3]; })");
+    assert(98, ({ char *a = "a\0b"; a[2]; }), "({ char *a = \"a\\0b\"; a[2]; })");
+    // struct copy with wide moves
+    assert(7, ({ struct t {char a[13];} x; struct t y; x.a[12]=7; y=x; y.a[12]; }), "({ struct t {char a[13];} x; struct t y; x.a[12]=7; y=x; y.a[12]; })");
+    assert(12, ({ struct t {long a; int b[5];} x; struct t y; x.a=5; x.b[4]=7; y=x; y.a+y.b[4]; }), "({ struct t {long a; int b[5];} x; struct t y; x.a=5; x.b[4]=7; y=x; y.a+y.b[4]; })");
+    assert(12, ({ struct t {char a[301]; int b;} x; struct t y; x.a[300]=7; x.b=5; y=x; y.a[300]+y.b; }), "({ struct t {char a[301]; int b;} x; struct t y; x.a[300]=7; x.b=5; y=x; y.a[300]+y.b; })");
+    assert(3, ({ struct t {int a[40];} x; struct t y; struct t *p=&y; x.a[39]=3; *p=x; y.a[39]; }), "({ struct t {int a[40];} x; struct t y; struct t *p=&y; x.a[39]=3; *p=x; y.a[39]; })");
+    // statically aligned call sites
+    assert(13, 2 + ({ 1 + add2(ret5(), 5); }), "2 + ({ 1 + add2(ret5(), 5); })");
+    assert(21, 1 + (2 + add6(1, 2, 3, 4, 5, 6) - 3), "1 + (2 + add6(1, 2, 3, 4, 5, 6) - 3)");
+    // logical operators
+    assert(1, 1 && 2, "1 && 2");
+    assert(0, 1 && 0, "1 && 0");
+    assert(0, 0 && 1, "0 && 1");
+    assert(1, 0 || 3, "0 || 3");
+    assert(0, 0 || 0, "0 || 0");
+    assert(1, !0, "!0");
+    assert(0, !5, "!5");
+    assert(1, !(1 && 0) || 0, "!(1 && 0) || 0");
+    assert(3, ({ int x=3; 0 && (x=5); x; }), "({ int x=3; 0 && (x=5); x; })");
+    assert(3, ({ int x=3; 1 || (x=5); x; }), "({ int x=3; 1 || (x=5); x; })");
+    assert(4, ({ int x[4]; x[0]=0; x[1]=1; x[2]=2; x[3]=3; int i=0; while(i<4 && x[i]==i) i=i+1; i; }), "({ int x[4]; x[0]=0; x[1]=1; x[2]=2; x[3]=3; int i=0; while(i<4 && x[i]==i) i=i+1; i; })");
+    assert(2, ({ int i=0; int j=0; for(; !(i>=5 || j==2); i=i+1) j=j+1; j; }), "({ int i=0; int j=0; for(; !(i>=5 || j==2); i=i+1) j=j+1; j; })");
+    assert(1, ({ int x=2; if(0 < x && !(x > 5)) x=1; x; }), "({ int x=2; if(0 < x && !(x > 5)) x=1; x; })");
+    // addressing-mode folding and read-modify-write
+    assert(5, ({ int x[4]; int i=1; x[i+1] = 5; x[2]; }), "({ int x[4]; int i=1; x[i+1] = 5; x[2]; })");
+    assert(7, ({ int x=3; x = x + 4; x; }), "({ int x=3; x = x + 4; x; })");
+    assert(-1, ({ char x[3]; x[1]=1; x[1] = x[1] - 2; x[1]; }), "({ char x[3]; x[1]=1; x[1] = x[1] - 2; x[1]; })");
+    assert(3, ({ int x[4]; int *p=x; x[2]=3; p = p + 1; p[1]; }), "({ int x[4]; int *p=x; x[2]=3; p = p + 1; p[1]; })");
+    assert(4, ({ struct {int a; int b[3];} x[2]; int i=1; x[i].b[2]=4; x[1].b[i+1]; }), "({ struct {int a; int b[3];} x[2]; int i=1; x[i].b[2]=4; x[1].b[i+1]; })");
+    g2[3] = 9; g2[3] = g2[3] - 1;
+    assert(8, g2[3], "g2[3]");
     assert(3, ({ int *x[3]; int y; x[1] = &y; y=3; *x[1]; }), "({ int *x[3]; int y; x[1] = &y; y=3; *x[1]; })");
     assert(3, ({ int *x[3]; int y; x[1] = &y; y=3; x[1][0]; }), "({ int *x[3]; int y; x[1] = &y; y=3; x[1][0]; })");
     assert(12, ({ int x[3]; char y[4]; &y - &x; }), "({ int x[3]; char y[4]; &y - &x; })");
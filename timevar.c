@@ -0,0 +1,166 @@
+#include "9cc.h"
+#include <sys/resource.h>
+#include <time.h>
+
+// Phase timers and counters for -ftime-report and -fmem-report
+//
+// Timers form a stack as in GCC: pushing a phase stops the clock of
+// the phase below it, so every phase reports exclusive time and the
+// phases add up to the total. Bytes allocated and growth of the peak
+// RSS are charged to phases the same way.
+
+typedef struct {
+    char *name;
+    double wall;
+    double cpu;
+    long bytes;  // bytes allocated
+    long rss;    // growth of the peak RSS in KiB
+    long peak;   // peak RSS in KiB when the phase last ended
+} Timer;
+
+static Timer timers[] = {
+    [TV_READ] = {"read"},
+    [TV_LEX] = {"lex"},
+    [TV_PARSE] = {"parse"},
+    [TV_TYPE] = {"type"},
+    [TV_PROFILE] = {"profile"},
+    [TV_INLINE] = {"inline"},
+    [TV_VECTORIZE] = {"vectorize"},
+    [TV_UNROLL] = {"unroll"},
+    [TV_LICM] = {"licm"},
+    [TV_CSE] = {"cse"},
+    [TV_DCE] = {"dce"},
+    [TV_FRAME] = {"frame layout"},
+    [TV_CODEGEN] = {"codegen"},
+    [TV_EMIT] = {"emit"},
+    [TV_ASSEMBLE] = {"assemble"},
+};
+
+Stats stats;
+
+static TimeVar stack[16];
+static int depth;
+static double last_wall;
+static double last_cpu;
+static long last_bytes;
+static long last_rss;
+
+static double now(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static long peak_rss(void) {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+// Charges the time and memory since the last switch to the phase on top.
+static void switch_phase(void) {
+    double wall = now(CLOCK_MONOTONIC);
+    double cpu = now(CLOCK_PROCESS_CPUTIME_ID);
+    long rss = peak_rss();
+    if(depth > 0) {
+        Timer *t = &timers[stack[depth - 1]];
+        t->wall += wall - last_wall;
+        t->cpu += cpu - last_cpu;
+        t->bytes += mem_allocated - last_bytes;
+        t->rss += rss - last_rss;
+        t->peak = rss;
+    }
+    last_wall = wall;
+    last_cpu = cpu;
+    last_bytes = mem_allocated;
+    last_rss = rss;
+}
+
+void timevar_push(TimeVar tv) {
+    if(!opt_time_report && !opt_mem_report)
+        return;
+    assert(depth < sizeof(stack) / sizeof(*stack));
+    switch_phase();
+    stack[depth++] = tv;
+}
+
+void timevar_pop(TimeVar tv) {
+    if(!opt_time_report && !opt_mem_report)
+        return;
+    assert(depth > 0 && stack[depth - 1] == tv);
+    switch_phase();
+    depth--;
+}
+
+static double rate(long n, double sec) {
+    return sec > 0 ? n / sec : 0;
+}
+
+static void print_text(void) {
+    double wall = 0, cpu = 0;
+    for(int i = 0; i < NUM_TIMEVARS; i++) {
+        wall += timers[i].wall;
+        cpu += timers[i].cpu;
+    }
+
+    fprintf(stderr, "Execution times (seconds)\n");
+    fprintf(stderr, "  %-14s %10s %6s %10s %6s\n", "phase", "wall", "", "cpu", "");
+    for(int i = 0; i < NUM_TIMEVARS; i++) {
+        Timer *t = &timers[i];
+        fprintf(stderr, "  %-14s %10.6f %5.1f%% %10.6f %5.1f%%\n", t->name,
+                t->wall, wall > 0 ? t->wall * 100 / wall : 0,
+                t->cpu, cpu > 0 ? t->cpu * 100 / cpu : 0);
+    }
+    fprintf(stderr, "  %-14s %10.6f %6s %10.6f\n", "TOTAL", wall, "", cpu);
+
+    fprintf(stderr, "Counters\n");
+    fprintf(stderr, "  %-22s %ld\n", "input bytes", stats.input_bytes);
+    fprintf(stderr, "  %-22s %ld (%.0f/s)\n", "tokens", stats.tokens,
+            rate(stats.tokens, timers[TV_LEX].wall));
+    fprintf(stderr, "  %-22s %ld\n", "AST nodes", stats.nodes);
+    fprintf(stderr, "  %-22s %ld\n", "add_type visits", stats.type_visits);
+    fprintf(stderr, "  %-22s %ld\n", "symbol lookups", stats.lookups);
+    fprintf(stderr, "  %-22s %.2f\n", "avg lookup chain",
+            stats.lookups ? (double)stats.lookup_steps / stats.lookups : 0);
+    fprintf(stderr, "  %-22s %ld\n", "max lookup chain", stats.max_lookup_chain);
+    fprintf(stderr, "  %-22s %ld\n", "asm instructions", stats.asm_insns);
+    fprintf(stderr, "  %-22s %ld (%.0f/s)\n", "asm bytes", stats.asm_bytes,
+            rate(stats.asm_bytes, timers[TV_CODEGEN].wall + timers[TV_EMIT].wall));
+    fprintf(stderr, "  %-22s %ldKB\n", "peak RSS", peak_rss());
+}
+
+static void print_json(void) {
+    fprintf(stderr, "{\n  \"phases\": [\n");
+    for(int i = 0; i < NUM_TIMEVARS; i++)
+        fprintf(stderr, "    {\"name\": \"%s\", \"wall\": %.9f, \"cpu\": %.9f}%s\n",
+                timers[i].name, timers[i].wall, timers[i].cpu,
+                i + 1 < NUM_TIMEVARS ? "," : "");
+    fprintf(stderr, "  ],\n  \"counters\": {\n");
+    fprintf(stderr, "    \"input_bytes\": %ld,\n", stats.input_bytes);
+    fprintf(stderr, "    \"tokens\": %ld,\n", stats.tokens);
+    fprintf(stderr, "    \"ast_nodes\": %ld,\n", stats.nodes);
+    fprintf(stderr, "    \"add_type_visits\": %ld,\n", stats.type_visits);
+    fprintf(stderr, "    \"symbol_lookups\": %ld,\n", stats.lookups);
+    fprintf(stderr, "    \"lookup_steps\": %ld,\n", stats.lookup_steps);
+    fprintf(stderr, "    \"max_lookup_chain\": %ld,\n", stats.max_lookup_chain);
+    fprintf(stderr, "    \"asm_insns\": %ld,\n", stats.asm_insns);
+    fprintf(stderr, "    \"asm_bytes\": %ld,\n", stats.asm_bytes);
+    fprintf(stderr, "    \"peak_rss_kb\": %ld\n", peak_rss());
+    fprintf(stderr, "  }\n}\n");
+}
+
+void print_time_report(void) {
+    if(opt_time_report_json)
+        print_json();
+    else
+        print_text();
+}
+
+void print_phase_memory(void) {
+    fprintf(stderr, "Memory by phase\n");
+    fprintf(stderr, "  %-14s %12s %12s %12s\n", "phase", "allocated", "RSS growth", "peak RSS");
+    for(int i = 0; i < NUM_TIMEVARS; i++) {
+        Timer *t = &timers[i];
+        fprintf(stderr, "  %-14s %12ld %10ldKB %10ldKB\n", t->name, t->bytes, t->rss, t->peak);
+    }
+}
@@ -0,0 +1,14396 @@
+.file 1 "tests/tests.c"
+.intel_syntax noprefix
+.bss
+.align 4
+.type g1, @object
+.size g1, 4
+g1:
+    .zero 4
+.align 16
+.type g2, @object
+.size g2, 16
+g2:
+    .zero 16
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.data.152:
+    .string "\177"
+.L.data.161:
+    .string "\007x\012y"
+.L.data.147:
+    .string "w"
+.L.data.195:
+    .string "bar"
+.L.data.194:
+    .string "foo"
+.L.data.46:
+    .string "a suffix pool"
+.set .L.data.44, .L.data.46+9
+.set .L.data.48, .L.data.46+10
+.set .L.data.186, .L.data.46+12
+.L.data.184:
+    .string "k"
+.L.data.182:
+    .string "j"
+.L.data.189:
+    .string "abc"
+.L.data.199:
+    .string "b"
+.L.data.198:
+    .string "a"
+.L.data.76:
+    .string "g2[3]"
+.L.data.165:
+    .string "\042\134ax\134ny\042[3]"
+.L.data.193:
+    .string "\042abc\042[3]"
+.L.data.206:
+    .string "g2[2]"
+.L.data.164:
+    .string "\042\134ax\134ny\042[2]"
+.L.data.192:
+    .string "\042abc\042[2]"
+.L.data.205:
+    .string "g2[1]"
+.L.data.163:
+    .string "\042\134ax\134ny\042[1]"
+.L.data.191:
+    .string "\042abc\042[1]"
+.L.data.204:
+    .string "g2[0]"
+.L.data.162:
+    .string "\042\134ax\134ny\042[0]"
+.L.data.175:
+    .string "\042\134v\042[0]"
+.L.data.171:
+    .string "\042\134t\042[0]"
+.L.data.179:
+    .string "\042\134r\042[0]"
+.L.data.173:
+    .string "\042\134n\042[0]"
+.L.data.187:
+    .string "\042\134l\042[0]"
+.L.data.185:
+    .string "\042\134k\042[0]"
+.L.data.183:
+    .string "\042\134j\042[0]"
+.L.data.177:
+    .string "\042\134f\042[0]"
+.L.data.181:
+    .string "\042\134e\042[0]"
+.L.data.190:
+    .string "\042abc\042[0]"
+.L.data.169:
+    .string "\042\134b\042[0]"
+.L.data.167:
+    .string "\042\134a\042[0]"
+.L.data.153:
+    .string "\042\134x7F\042[0]"
+.L.data.151:
+    .string "\042\134x77\042[0]"
+.L.data.158:
+    .string "\042\134101\042[0]"
+.L.data.154:
+    .string "\042\1340\042[0]"
+.L.data.156:
+    .string "\042\13420\042[0]"
+.L.data.150:
+    .string "\042\134x00\042[0]"
+.L.data.160:
+    .string "\042\1341500\042[0]"
+.L.data.157:
+    .string "A"
+.L.data.297:
+    .string "+8!=-8"
+.L.data.295:
+    .string "+8==+8"
+.L.data.296:
+    .string "+8!=+8"
+.L.data.308:
+    .string "+3*-5+37"
+.L.data.312:
+    .string "5+6*7"
+.L.data.317:
+    .string "15"
+.L.data.313:
+    .string "2*3+4*5"
+.L.data.64:
+    .string "!5"
+.L.data.41:
+    .string "early_ret(1) + early_ret(1) - 5"
+.L.data.315:
+    .string "5+20-4"
+.L.data.61:
+    .string "0 || 3"
+.L.data.293:
+    .string "42!=42"
+.L.data.310:
+    .string "(3+5)/2"
+.L.data.58:
+    .string "1 && 2"
+.L.data.85:
+    .string "g1"
+.L.data.292:
+    .string "0!=1"
+.L.data.301:
+    .string "+200<=+201"
+.L.data.300:
+    .string "+200<+201"
+.L.data.60:
+    .string "0 && 1"
+.L.data.159:
+    .string "h0"
+.L.data.306:
+    .string "- -10"
+.L.data.307:
+    .string "- - +10"
+.L.data.302:
+    .string "+201>+200"
+.L.data.303:
+    .string "+201>=+200"
+.L.data.305:
+    .string "+201<=+200"
+.L.data.299:
+    .string "+200<=+200"
+.L.data.304:
+    .string "+201<+200"
+.L.data.298:
+    .string "+200<+200"
+.L.data.309:
+    .string "-100+200"
+.L.data.63:
+    .string "!0"
+.L.data.62:
+    .string "0 || 0"
+.L.data.65:
+    .string "!(1 && 0) || 0"
+.L.data.59:
+    .string "1 && 0"
+.set .L.data.316, .L.data.59+5
+.L.data.115:
+    .string "({int x[5]; int *y = x+2; y-x;})"
+.L.data.120:
+    .ascii "({struct {char a; int b; char c;} x; x.a = 1; x.b = 2; x.c = 3; "
+    .string "x.c;})"
+.L.data.119:
+    .ascii "({struct {char a; int b; char c;} x; x.a = 1; x.b = 2; x.c = 3; "
+    .string "x.b;})"
+.L.data.124:
+    .string "({struct {char a; char b;} x[3]; char *p=x; p[3] = 3; x[1].b;})"
+.L.data.122:
+    .string "({struct {char a; char b;} x[3]; char *p=x; p[1] = 1; x[0].b;})"
+.L.data.118:
+    .ascii "({struct {char a; int b; char c;} x; x.a = 1; x.b = 2; x.c = 3; "
+    .string "x.a;})"
+.L.data.123:
+    .string "({struct {char a; char b;} x[3]; char *p=x; p[2] = 2; x[1].a;})"
+.L.data.121:
+    .string "({struct {char a; char b;} x[3]; char *p=x; p[0] = 0; x[0].a;})"
+.L.data.114:
+    .string "({char x; int y; int a = &x; int b = &y; b-a;})"
+.L.data.113:
+    .string "({int x; char y; int a = &x; int b = &y; b-a;})"
+.L.data.126:
+    .ascii "({struct {char a[3]; char b[5];} x; char *p = &x; x.b[0]=7; p[3]"
+    .string ";})"
+.L.data.125:
+    .ascii "({struct {char a[3]; char b[5];} x; char *p = &x; x.a[0]=6; p[0]"
+    .string ";})"
+.L.data.148:
+    .string "({\042\134x77\042[0];})"
+.L.data.146:
+    .string "({1;}) + ({2;}) + ({3;})"
+.L.data.291:
+    .string "({1; 2; 3;})"
+.L.data.145:
+    .string "({1;})"
+.L.data.129:
+    .string "({struct {int a; int b;} x; sizeof(x);})"
+.L.data.134:
+    .string "({struct {int a; char b;} x; sizeof(x);})"
+.L.data.133:
+    .string "({struct {char a; char b;} x; sizeof(x);})"
+.L.data.128:
+    .string "({struct {int a;} x; sizeof(x);})"
+.L.data.130:
+    .string "({struct {int a[3];} x; sizeof(x);})"
+.L.data.131:
+    .string "({struct {int a;} x[4]; sizeof(x);})"
+.L.data.132:
+    .string "({struct {int a[3];} x[2]; sizeof(x);})"
+.L.data.200:
+    .string "({ char *g; { g = \042a\042; char *g = \042b\042; g[0]; } })"
+.L.data.254:
+    .string "({ int x = 3; int *y = &x; int **z = &y; **z; })"
+.L.data.288:
+    .string "({ int a = 3; int z = 5; a + z; })"
+.L.data.251:
+    .string "({ int x = 3; int y = &x; &x+1 == &y; })"
+.L.data.80:
+    .string "({ char y[4]; int x[3]; &x - &y; })"
+.L.data.81:
+    .string "({ char y[4]; int x[2]; &x - &y; })"
+.L.data.260:
+    .string "({ int x = 3; int y = 5; *(&x+1) = 7; y; })"
+.L.data.112:
+    .string "({ struct t {int x;}; int t=1; struct t y; y.x=2; t + y.x; })"
+.L.data.232:
+    .string "({ int x[2][3]; int *y = x; *y = 0; **x; })"
+.L.data.244:
+    .string "({ int x[3]; *x = 3; *(x+1) = 4; *(x+2) = 5; *x; })"
+.L.data.243:
+    .string "({ int x[2]; int *y = x; *y = 3; *x; })"
+.L.data.79:
+    .string "({ int x[3]; char y[4]; &y - &x; })"
+.L.data.140:
+    .string "({ int x = 2; { x = 3; } x; })"
+.L.data.138:
+    .string "({ int x = 2; { int x = 3; } x; })"
+.L.data.217:
+    .string "({ int x; sizeof x; })"
+.L.data.209:
+    .string "({int x; x; })"
+.L.data.252:
+    .string "({ int x = 3; int y = 5; *(&y-1) = 7; x; })"
+.L.data.259:
+    .string "({ int x = 3; int *y = &x; *y = 5; x; })"
+.L.data.9:
+    .string "({ int x=2; if(1<2) x=3; else x=4; x; })"
+.L.data.139:
+    .string "({ int x = 2; { int x = 3; } int y = 4; x; })"
+.L.data.72:
+    .string "({ int x=3; x = x + 4; x; })"
+.L.data.144:
+    .string "({ int x=3; x; })"
+.L.data.280:
+    .string "({ int x; if(2-1) x = 2; else x = 3; x; })"
+.L.data.278:
+    .string "({ int x; if(1-1) x = 2; else x = 3; x; })"
+.L.data.279:
+    .string "({ int x; if(1) x = 2; else x = 3; x; })"
+.L.data.277:
+    .string "({ int x; if(0) x = 2; else x = 3; x; })"
+.L.data.11:
+    .string "({ int x=1; for(x=7; 0;) x=2; x; })"
+.L.data.8:
+    .string "({ int x=1; if(0) x=2; x; })"
+.L.data.10:
+    .string "({ int x=1; while(0) x=2; x; })"
+.L.data.203:
+    .string "({ char x=1; x; })"
+.L.data.70:
+    .string "({ int x=2; if(0 < x && !(x > 5)) x=1; x; })"
+.L.data.67:
+    .string "({ int x=3; 1 || (x=5); x; })"
+.L.data.66:
+    .string "({ int x=3; 0 && (x=5); x; })"
+.L.data.21:
+    .ascii "({ int x[6]; int i; for(i=0; i<6; i=i+1) x[i]=i; int s=0; i=1; w"
+    .string "hile(i<6) { s=s+x[i]; i=i+2; } s; })"
+.L.data.20:
+    .ascii "({ int *p=0; int i=0; int s=0; while(i<0) { s=s+*p; i=i+1; } s; "
+    .string "})"
+.L.data.18:
+    .ascii "({ int x[4]; x[0]=3; x[1]=5; x[2]=7; x[3]=9; int i=0; int k=2; i"
+    .string "nt s=0; while(i<4) { s=s+x[i]*x[k]; i=i+1; } s; })"
+.L.data.19:
+    .ascii "({ int x[3]; x[0]=1; x[1]=2; x[2]=3; int i=0; int s=0; while(i<3"
+    .string ") { s=s+x[0]; x[0]=x[0]+1; i=i+1; } s; })"
+.L.data.3:
+    .ascii "({ char x[20]; int i; int s=0; for(i=0; i<20; i=i+1) x[i]=0-i; f"
+    .string "or(i=0; i<19; i=i+1) s=s+x[i]; s; })"
+.L.data.32:
+    .string "({ int i; int s=0; for(i=0-4; i<0; i=i+1) s=s+abs_int(i); s; })"
+.L.data.282:
+    .string "({ int foo123=3; int bar=5; foo123+bar; })"
+.L.data.283:
+    .string "({ int foo = 1; int bar = 2 + 3; foo + bar; })"
+.L.data.248:
+    .string "({ int foo = 3; *&foo; })"
+.L.data.281:
+    .string "({ int foo=3; foo; })"
+.L.data.16:
+    .string "({ int i=3; int j=4; int a=0; if(i>5) a=i*j; a+i*j; })"
+.L.data.15:
+    .string "({ int i=1; int j=2; int a=i*j; i=5; a+i*j; })"
+.L.data.17:
+    .string "({ int i=0; int j=4; (i && i*j) + (i+1)*j; })"
+.L.data.273:
+    .string "({ int i=0; int j=0; while(i <= 10) { j=i+j; i=i+1;} j; })"
+.L.data.275:
+    .string "({ int i=0; int j=0; for(; i <= 10; i=i+1) j=j+i; j; })"
+.L.data.137:
+    .string "({int i=2, j=3; (i=5,j)=6; j; })"
+.L.data.69:
+    .string "({ int i=0; int j=0; for(; !(i>=5 || j==2); i=i+1) j=j+1; j; })"
+.L.data.23:
+    .string "({ int i; int n=11; int s=0; for(i=0; i<n; i=i+1) s=s+i; s+i; })"
+.L.data.25:
+    .string "({ int i; int n=0; int s=0; for(i=0; i<n; i=i+1) s=s+1; s+i; })"
+.L.data.22:
+    .string "({ int i; int s=0; for(i=0; i<5; i=i+1) s=s+i; s*10+i; })"
+.L.data.24:
+    .ascii "({ int i; int n=10; int s=0; for(i=1; i<=n; i=i+3) s=s+i; s*100+"
+    .string "i; })"
+.L.data.136:
+    .string "({int i=2, j=3; (i=5,j)=6; i; })"
+.L.data.68:
+    .ascii "({ int x[4]; x[0]=0; x[1]=1; x[2]=2; x[3]=3; int i=0; while(i<4 "
+    .string "&& x[i]==i) i=i+1; i; })"
+.L.data.276:
+    .string "({ int i = 0; while(i < 10) i=i+1; i; })"
+.L.data.54:
+    .ascii "({ struct t {char a[301]; int b;} x; struct t y; x.a[300]=7; x.b"
+    .string "=5; y=x; y.a[300]+y.b; })"
+.L.data.99:
+    .string "({ struct t {int a; int b;} x; struct t y; x.b=5; y=x; y.b; })"
+.L.data.103:
+    .string "({ struct t {int a; char b;} x; struct t y; x.b=3; y=x; y.b; })"
+.L.data.117:
+    .string "({struct {int a; int b;} x; x.a = 1; x.b = 2; x.b; })"
+.L.data.127:
+    .string "({struct {struct {char b;} a;} x; x.a.b=6; x.a.b; })"
+.L.data.274:
+    .ascii "({ int i=0; int j=0; int a; int b; for(; i <= 10; i=i+1) { a = 1"
+    .string "; b = 2; j=j+i; } j+a+b; })"
+.L.data.12:
+    .ascii "({ int x[4]; x[2]=6; int i=2; int a=x[i]*3; int b=x[i]*3+1; a+b;"
+    .string " })"
+.L.data.45:
+    .string "({ char *a = \042pool\042; char *b = \042pool\042; a == b; })"
+.L.data.287:
+    .string "({ int a = 2; int b = 2; b; })"
+.L.data.107:
+    .string "({ struct t {char a;} x; struct t *y = &x; x.a = 3; y->a; })"
+.L.data.100:
+    .ascii "({ struct t {int a; int b;}; struct t x; x.a=7; struct t y; stru"
+    .string "ct t *z=&y; *z=x; y.a; })"
+.L.data.98:
+    .string "({ struct t {int a; int b;} x; struct t y; x.a=5; y=x; y.a; })"
+.L.data.102:
+    .string "({ struct t {char a; char b;} x; struct t y; x.a=5; y=x; y.a; })"
+.L.data.101:
+    .ascii "({ struct t {int a; int b;}; struct t x; x.a=7; struct t y; stru"
+    .string "ct t *p=&x; struct t *q=&y; *q=*p; y.a; })"
+.L.data.108:
+    .string "({ struct t {char a;} x; struct t *y = &x; y->a=3; x.a; })"
+.L.data.116:
+    .string "({struct {int a; int b;} x; x.a = 1; x.b = 2; x.a; })"
+.L.data.286:
+    .string "({ int a=2; int b=2; a; })"
+.L.data.285:
+    .string "({ int a=2; a; })"
+.L.data.82:
+    .string "({ int x; char y; int a = &x; int b = &y; b - a; })"
+.L.data.84:
+    .string "({ char y; int x; int a = &y; int b = &x; b - a; })"
+.L.data.83:
+    .string "({ char y[3]; int x; int a = &y; int b = &x; b - a; })"
+.L.data.55:
+    .ascii "({ struct t {int a[40];} x; struct t y; struct t *p=&y; x.a[39]="
+    .string "3; *p=x; y.a[39]; })"
+.L.data.53:
+    .ascii "({ struct t {long a; int b[5];} x; struct t y; x.a=5; x.b[4]=7; "
+    .string "y=x; y.a+y.b[4]; })"
+.L.data.6:
+    .ascii "({ int x[12]; int i; for(i=0; i<12; i=i+1) x[i]=i; vec_add(x, x+"
+    .string "4, x+4, 8)+x[3]; })"
+.L.data.213:
+    .ascii "({ int x[4]; { x[0] = 0; x[1] = 1; x[2] = 2; x[3] = 3; } x[3]; }"
+    .string ")"
+.L.data.49:
+    .string "({ char *b = \042ool\042; b[3]; })"
+.L.data.212:
+    .ascii "({ int x[4]; { x[0] = 0; x[1] = 1; x[2] = 2; x[3] = 3; } x[2]; }"
+    .string ")"
+.L.data.71:
+    .string "({ int x[4]; int i=1; x[i+1] = 5; x[2]; })"
+.L.data.51:
+    .string "({ char *a = \042a\1340b\042; a[2]; })"
+.L.data.231:
+    .string "({ int x[2][3]; int *y = x; y[5] = 5; x[1][2]; })"
+.L.data.228:
+    .string "({ int x[2][3]; int *y = x; y[2] = 2; x[0][2]; })"
+.L.data.52:
+    .ascii "({ struct t {char a[13];} x; struct t y; x.a[12]=7; y=x; y.a[12]"
+    .string "; })"
+.L.data.77:
+    .string "({ int *x[3]; int y; x[1] = &y; y=3; *x[1]; })"
+.L.data.211:
+    .ascii "({ int x[4]; { x[0] = 0; x[1] = 1; x[2] = 2; x[3] = 3; } x[1]; }"
+    .string ")"
+.L.data.73:
+    .string "({ char x[3]; x[1]=1; x[1] = x[1] - 2; x[1]; })"
+.L.data.74:
+    .string "({ int x[4]; int *p=x; x[2]=3; p = p + 1; p[1]; })"
+.L.data.106:
+    .string "({ union {int a; char b[4];} x; x.a = 515; x.b[1]; })"
+.L.data.47:
+    .string "({ char *a = \042a suffix pool\042; char *b = \042pool\042; b[1]; })"
+.L.data.230:
+    .string "({ int x[2][3]; int *y = x; y[4] = 4; x[1][1]; })"
+.L.data.227:
+    .string "({ int x[2][3]; int *y = x; y[1] = 1; x[0][1]; })"
+.L.data.75:
+    .ascii "({ struct {int a; int b[3];} x[2]; int i=1; x[i].b[2]=4; x[1].b["
+    .string "i+1]; })"
+.L.data.4:
+    .ascii "({ char x[17]; char y[17]; int i; for(i=0; i<17; i=i+1) x[i]=i; "
+    .string "for(i=0; i<17; i=i+1) y[i]=x[i]-1; y[16]+y[0]; })"
+.L.data.14:
+    .ascii "({ int x[1]; x[0]=2; int a=x[0]*x[0]; bump(x); a*10+x[0]*x[0]; }"
+    .string ")"
+.L.data.210:
+    .ascii "({ int x[4]; { x[0] = 0; x[1] = 1; x[2] = 2; x[3] = 3; } x[0]; }"
+    .string ")"
+.L.data.105:
+    .string "({ union {int a; char b[4];} x; x.a = 515; x.b[0]; })"
+.L.data.196:
+    .string "({ char *a = \042foo\042; char *b = \042bar\042; a[0]; })"
+.L.data.78:
+    .string "({ int *x[3]; int y; x[1] = &y; y=3; x[1][0]; })"
+.L.data.229:
+    .string "({ int x[2][3]; int *y = x; y[3] = 3; x[1][0]; })"
+.L.data.92:
+    .string "({ int x[3]; int (*y)[3]=x; y[0][0]=4; y[0][0]; })"
+.L.data.91:
+    .string "({ int *x[3]; int y; x[0] = &y; y=3; x[0][0]; })"
+.L.data.226:
+    .string "({ int x[2][3]; int *y = x; y[0] = 0; x[0][0]; })"
+.L.data.5:
+    .ascii "({ int x[12]; int i; for(i=0; i<12; i=i+1) x[i]=1; vec_add(x+1, "
+    .string "x, x, 10); x[10]; })"
+.L.data.42:
+    .string "({ long a = g2; a - a/16*16; })"
+.L.data.290:
+    .string "({ 5; })"
+.L.data.36:
+    .string "({ char c; c = 0; c = c + 1000; c == 0-24; })"
+.L.data.43:
+    .string "({ long a = &g1; a - a/4*4; })"
+.L.data.271:
+    .string "({ 1; {2;} 3; })"
+.L.data.289:
+    .string "({ 3; })"
+.L.data.13:
+    .string "({ int x[2]; x[0]=4; int i=0; int a=x[i]*2; x[0]=5; a+x[i]*2; })"
+.L.data.141:
+    .string "({ 0; 1; 2; })"
+.L.data.142:
+    .string "({ 0; ({1;}); 2; })"
+.L.data.143:
+    .string "({ 0; ({1-1;}); 2; })"
+.L.data.284:
+    .string "({ int a = 2; int b = 5 * 6 - 8; (a + b) / 2; })"
+.L.data.250:
+    .string "({ int x = 3; int y = &x; &x+1 == y+1; })"
+.L.data.224:
+    .string "({ int x[3][4]; sizeof **x + 1; })"
+.L.data.223:
+    .string "({ int x[3][4]; sizeof(**x) + 1; })"
+.L.data.2:
+    .ascii "({ int x[10]; int y[10]; int i; for(i=0; i<10; i=i+1) x[i]=i; fo"
+    .string "r(i=0; i<10; i=i+1) y[i]=x[i]+3; y[0]+y[9]*10+i*100; })"
+.L.data.272:
+    .string "({ 0; })"
+.L.data.111:
+    .ascii "({ struct t {char a[2];}; { struct t {char a[4];}; } struct t y;"
+    .string " sizeof(y); })"
+.L.data.110:
+    .string "({ struct t {int a; int b;}; struct t y; sizeof(y); })"
+.L.data.109:
+    .string "({ struct t {int a; int b;} x; struct t y; sizeof(y); })"
+.L.data.253:
+    .string "({ int x = 3; int y = 5; foo(&x, y); })"
+.L.data.222:
+    .string "({ int x[3][4]; sizeof(**x); })"
+.L.data.221:
+    .string "({ int x[3][4]; sizeof(*x); })"
+.L.data.218:
+    .string "({ int *x; sizeof(x); })"
+.L.data.104:
+    .string "({ union {int a; char b[6];} x; sizeof(x); })"
+.L.data.94:
+    .string "({ struct { char a; short b; } x; sizeof(x); })"
+.L.data.216:
+    .string "({ int x; sizeof(x); })"
+.L.data.219:
+    .string "({ int x[4]; sizeof(x); })"
+.L.data.88:
+    .string "({ int *x[3][4]; sizeof(x); })"
+.L.data.220:
+    .string "({ int x[3][4]; sizeof(x); })"
+.L.data.87:
+    .string "({ int (*x)[3][4]; sizeof(x); })"
+.L.data.90:
+    .string "({ int *x[3]; sizeof(x); })"
+.L.data.89:
+    .string "({ int (*x)[3]; sizeof(x); })"
+.L.data.214:
+    .string "({ int x;  sizeof(x); })"
+.L.data.215:
+    .string "({ int x[4];  sizeof(x); })"
+.L.data.249:
+    .string "({ int foo = 3; int bar = 5; (*&foo)+(*&bar); })"
+.L.data.202:
+    .string "({ char *g; sizeof(g); })"
+.L.data.201:
+    .string "({ char g[3]; sizeof(g); })"
+.L.data.93:
+    .string "({ short c; sizeof(c); })"
+.L.data.95:
+    .string "({ long c; sizeof(c); })"
+.L.data.96:
+    .string "({ short a = 5; short b = 3; short c = 1; sub_short(a, b, c); })"
+.L.data.97:
+    .string "({ long a = 5; long b = 3; long c = 1; sub_long(a, b, c); })"
+.L.data.56:
+    .string "2 + ({ 1 + add2(ret5(), 5); })"
+.L.data.242:
+    .string "({ int x[2][3]; int *y = x; *(y+6) == *(*(x+1)+3); })"
+.L.data.239:
+    .string "({ int x[2][3]; int *y = x; *(y+3) == *(*(x+0)+3); })"
+.L.data.238:
+    .string "({ int x[2][3]; **(x+1) == *(*(x+0)+3); })"
+.L.data.263:
+    .string "({ int a = 1; int b = 2; int c = 3; a + b + c + sub2(4, 3); })"
+.L.data.241:
+    .string "({ int x[2][3]; int *y = x; *(y+6) == **(x+2); })"
+.L.data.240:
+    .string "({ int x[2][3]; *(*(x+1)+3) == **(x+2); })"
+.L.data.247:
+    .string "({ int x[3]; int *y = x; *(y+2) == *(x+2); })"
+.L.data.246:
+    .string "({ int x[3]; *x = 3; *(x+1) = 4; *(x+2) = 5; *(x+2); })"
+.L.data.237:
+    .string "({ int x[2][3]; int *y = x; *(y+5) = 5; *(*(x+1)+2); })"
+.L.data.234:
+    .string "({ int x[2][3]; int *y = x; *(y+2) = 2; *(*(x+0)+2); })"
+.L.data.258:
+    .string "({ int x = 3; int y = 5; int z = 22; *(&z - 2); })"
+.L.data.257:
+    .string "({ int x = 3; int y = 5; int z = 22; *(&x + 2); })"
+.L.data.235:
+    .string "({ int x[2][3]; int *y = x; *(y+3) = 3; **(x+1); })"
+.L.data.245:
+    .string "({ int x[3]; *x = 3; *(x+1) = 4; *(x+2) = 5; *(x+1); })"
+.L.data.236:
+    .string "({ int x[2][3]; int *y = x; *(y+4) = 4; *(*(x+1)+1); })"
+.L.data.233:
+    .string "({ int x[2][3]; int *y = x; *(y+1) = 1; *(*(x+0)+1); })"
+.L.data.256:
+    .string "({ int x = 3; int y = 5; *(&y - 1); })"
+.L.data.225:
+    .string "({ int x[3][4]; sizeof(**x + 1); })"
+.L.data.255:
+    .string "({ int x = 3; int y = 5; *(&x + 1); })"
+.L.data.265:
+    .string "fib(9)"
+.L.data.311:
+    .string "5*(9-6)"
+.L.data.266:
+    .string "add6(1,2,3,4,5,6)"
+.L.data.7:
+    .string "dead_code(6)"
+.L.data.30:
+    .string "abs_int(0-5)"
+.L.data.294:
+    .string "+8-(3+5)"
+.L.data.35:
+    .string "tail_in_cond(5)"
+.L.data.264:
+    .string "fib(5)"
+.L.data.267:
+    .string "add(3, 5)"
+.L.data.135:
+    .string "(1,2,3)"
+.L.data.29:
+    .string "tail_in_expr(3)"
+.L.data.57:
+    .string "1 + (2 + add6(1, 2, 3, 4, 5, 6) - 3)"
+.L.data.268:
+    .string "sub(5, 3)"
+.L.data.262:
+    .string "sub2(4, 3)"
+.L.data.39:
+    .string "kept_or(0, 3)"
+.L.data.208:
+    .string "sizeof(g2)"
+.L.data.37:
+    .string "kept_and(1, 2)"
+.L.data.261:
+    .string "add2(1, 2)"
+.L.data.207:
+    .string "sizeof(g1)"
+.L.data.27:
+    .string "is_odd(100001)"
+.L.data.28:
+    .string "tail_in_expr(200)"
+.L.data.33:
+    .string "early_ret(0)"
+.L.data.38:
+    .string "kept_and(1, 0)"
+.L.data.26:
+    .string "sum_to(10000, 0)"
+.L.data.40:
+    .string "kept_or(0, 0)"
+.L.data.31:
+    .string "1 + (2 + max2(9, ret3()))"
+.L.data.86:
+    .string "g1_ptr()"
+.L.data.34:
+    .string "dead_inline_store()"
+.L.data.188:
+    .string "queenssol8()"
+.L.data.270:
+    .string "ret5()"
+.L.data.269:
+    .string "ret3()"
+.L.data.197:
+    .string "sizeof(\042abc\042)"
+.L.data.314:
+    .string "12 + 34 - 5 "
+.L.data.180:
+    .string "\033"
+.L.data.155:
+    .string "\020"
+.L.data.178:
+    .string "\015"
+.L.data.176:
+    .string "\014"
+.L.data.174:
+    .string "\013"
+.L.data.1:
+    .string "%s => %d expected but got %d\012"
+.L.data.0:
+    .string "%s => %d\012"
+.L.data.318:
+    .string "echo OK\012"
+.set .L.data.172, .L.data.318+7
+.L.data.170:
+    .string "\011"
+.L.data.168:
+    .string "\010"
+.L.data.166:
+    .string "\007"
+.section .rodata
+.L.data.50:
+    .ascii "a\000b\000"
+.L.data.149:
+    .ascii "\000\000"
+.text
+.global assert
+.type assert, @function
+assert:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-16], edi
+    mov [rbp-12], esi
+    mov [rbp-8], rdx
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-16]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.1
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-8]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.1
+.L.else.1:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-8]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-16]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.1:
+#----- Epilogue
+.L.return.assert:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size assert, .-assert
+.global ret3
+.type ret3, @function
+ret3:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 0
+    .loc 1 27 12
+#----- Returns to the caller address.
+    mov rax, 3
+#----- Epilogue
+.L.return.ret3:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size ret3, .-ret3
+.global ret5
+.type ret5, @function
+ret5:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 0
+    .loc 1 32 12
+#----- Returns to the caller address.
+    mov rax, 5
+#----- Epilogue
+.L.return.ret5:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size ret5, .-ret5
+.global add2
+.type add2, @function
+add2:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-8], edi
+    mov [rbp-4], esi
+    .loc 1 36 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    push rax
+    .loc 1 36 14
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.add2:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size add2, .-add2
+.global sub2
+.type sub2, @function
+sub2:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-8], edi
+    mov [rbp-4], esi
+    .loc 1 40 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    push rax
+    .loc 1 40 14
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.sub2:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size sub2, .-sub2
+.global add6
+.type add6, @function
+add6:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 32
+    mov [rbp-24], edi
+    mov [rbp-20], esi
+    mov [rbp-16], edx
+    mov [rbp-12], ecx
+    mov [rbp-8], r8d
+    mov [rbp-4], r9d
+    .loc 1 44 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-24]
+    push rax
+    .loc 1 44 14
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-20]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 44 16
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-16]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 44 18
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 44 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 44 22
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.add6:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size add6, .-add6
+.global fib
+.type fib, @function
+fib:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-4], edi
+    .loc 1 49 5
+#----- "If" statement
+    cmp dword ptr [rbp-4], 1
+    jg .L.end.2
+#----- Block {...} or Statement expression
+    .loc 1 50 16
+#----- Returns to the caller address.
+    mov rax, 1
+    jmp .L.return.fib
+.L.end.2:
+#----- Function call with up to 6 parameters. 
+    .loc 1 52 16
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 52 18
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+#-- 引数をレジスタにセット 
+    mov rdi, rax
+    xor eax, eax
+    call fib
+    push rax
+#----- Function call with up to 6 parameters. 
+    .loc 1 52 27
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 52 29
+    mov rdi, 2
+    pop rax
+    sub rax, rdi
+#-- 引数をレジスタにセット 
+    mov rdi, rax
+    sub rsp, 8
+    xor eax, eax
+    call fib
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.fib:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size fib, .-fib
+.global foo
+.type foo, @function
+foo:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-16], rdi
+    mov [rbp-4], esi
+#----- Load a value from the memory address.
+    .loc 1 56 13
+#----- Load a value from the memory address.
+    mov rax, [rbp-16]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 56 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.foo:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size foo, .-foo
+.global sub_short
+.type sub_short, @function
+sub_short:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-6], di
+    mov [rbp-4], si
+    mov [rbp-2], dx
+    .loc 1 60 12
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-6]
+    push rax
+    .loc 1 60 16
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-4]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 60 20
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-2]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.sub_short:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size sub_short, .-sub_short
+.global sub_long
+.type sub_long, @function
+sub_long:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 32
+    mov [rbp-24], rdi
+    mov [rbp-16], rsi
+    mov [rbp-8], rdx
+    .loc 1 64 12
+#----- Load a value from the memory address.
+    mov rax, [rbp-24]
+    push rax
+    .loc 1 64 16
+#----- Load a value from the memory address.
+    mov rax, [rbp-16]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 64 20
+#----- Load a value from the memory address.
+    mov rax, [rbp-8]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.sub_long:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size sub_long, .-sub_long
+.global g1_ptr
+.type g1_ptr, @function
+g1_ptr:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 0
+    .loc 1 68 12
+#----- Global variable
+#----- Returns to the caller address.
+    mov rax, offset g1
+#----- Epilogue
+.L.return.g1_ptr:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size g1_ptr, .-g1_ptr
+.global vec_add
+.type vec_add, @function
+vec_add:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 32
+    mov [rbp-32], rdi
+    mov [rbp-24], rsi
+    mov [rbp-16], rdx
+    mov [rbp-8], ecx
+#----- "For" statement
+#----- Expression statement
+    .loc 1 73 14
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+#----- Vectorized loop
+    .loc 1 73 21
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    push rax
+    .loc 1 73 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 74 9
+#----- Load a value from the memory address.
+    mov rax, [rbp-32]
+    push rax
+    .loc 1 74 23
+#----- Load a value from the memory address.
+    mov rax, [rbp-16]
+    push rax
+    .loc 1 74 16
+#----- Load a value from the memory address.
+    mov rax, [rbp-24]
+    mov rsi, rax
+    pop rdx
+    pop rdi
+    pop rcx
+    pop r8
+    mov rax, rdi
+    sub rax, rsi
+    sub rax, 1
+    cmp rax, 15
+    jb .L.vec.end.4
+    mov rax, rdi
+    sub rax, rdx
+    sub rax, 1
+    cmp rax, 15
+    jb .L.vec.end.4
+    .p2align 4,,10
+.L.vec.begin.4:
+    lea rax, [rcx+4]
+    cmp rax, r8
+    jg .L.vec.end.4
+    movdqu xmm0, [rsi+rcx*4]
+    movdqu xmm3, [rdx+rcx*4]
+    paddd xmm0, xmm3
+    movdqu [rdi+rcx*4], xmm0
+    mov rcx, rax
+    jmp .L.vec.begin.4
+.L.vec.end.4:
+    mov rdi, rcx
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+    .loc 1 73 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 73 21
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jge .L.end.3
+    .p2align 4,,10
+.L.begin.3:
+#----- Expression statement
+    .loc 1 74 9
+#----- Load a value from the memory address.
+    mov rax, [rbp-32]
+    push rax
+    .loc 1 74 11
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+#----- Load a value from the memory address.
+    .loc 1 74 16
+#----- Load a value from the memory address.
+    mov rax, [rbp-24]
+    push rax
+    .loc 1 74 18
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdx, rax
+    pop rax
+    movsxd rax, dword ptr [rax+rdx*4]
+    push rax
+#----- Load a value from the memory address.
+    .loc 1 74 23
+#----- Load a value from the memory address.
+    mov rax, [rbp-16]
+    push rax
+    .loc 1 74 25
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdx, rax
+    pop rax
+    movsxd rax, dword ptr [rax+rdx*4]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rdx
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+rdx*4], edi
+#----- Expression statement
+    .loc 1 73 26
+#----- Read-modify-write
+    add dword ptr [rbp-4], 1
+    movsxd rax, dword ptr [rbp-4]
+    .loc 1 73 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 73 21
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jl .L.begin.3
+.L.end.3:
+    .loc 1 75 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.vec_add:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size vec_add, .-vec_add
+.global dead_code
+.type dead_code, @function
+dead_code:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-8], edi
+#----- Expression statement
+    .loc 1 81 9
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    push rax
+    .loc 1 81 13
+    mov rdi, 2
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+    .loc 1 88 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 88 16
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.dead_code:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size dead_code, .-dead_code
+.global bump
+.type bump, @function
+bump:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-8], rdi
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 93 6
+#----- Load a value from the memory address.
+    mov rax, [rbp-8]
+    add dword ptr [rax], 1
+    movsxd rax, dword ptr [rax]
+    .loc 1 94 12
+#----- Returns to the caller address.
+    mov rax, 0
+#----- Epilogue
+.L.return.bump:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size bump, .-bump
+.global early_ret
+.type early_ret, @function
+early_ret:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-8], edi
+#----- Expression statement
+    .loc 1 98 13
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+    .loc 1 99 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+#----- Block {...} or Statement expression
+#----- "If" statement
+    .loc 1 99 23
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    test rax, rax
+    je .L.end.5
+    .loc 1 99 33
+#----- Returns to the caller address.
+    mov rax, 5
+    jmp .L.return.early_ret
+.L.end.5:
+    .loc 1 99 36
+    mov rdi, 3
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.early_ret:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size early_ret, .-early_ret
+.global max2
+.type max2, @function
+max2:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-8], edi
+    mov [rbp-4], esi
+#----- "If" statement
+    .loc 1 109 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    push rax
+    .loc 1 109 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jge .L.end.6
+    .loc 1 110 16
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+#----- Returns to the caller address.
+    jmp .L.return.max2
+.L.end.6:
+    .loc 1 111 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.max2:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size max2, .-max2
+.global sum_to
+.type sum_to, @function
+sum_to:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-16], rdi
+    mov [rbp-8], rsi
+.L.body.sum_to:
+    .loc 1 115 5
+#----- "If" statement
+    cmp qword ptr [rbp-16], 0
+    jne .L.end.7
+    .loc 1 116 16
+#----- Load a value from the memory address.
+    mov rax, [rbp-8]
+#----- Returns to the caller address.
+    jmp .L.return.sum_to
+.L.end.7:
+#----- Tail call
+    .loc 1 117 19
+#----- Load a value from the memory address.
+    mov rax, [rbp-16]
+    push rax
+    .loc 1 117 23
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 117 26
+#----- Load a value from the memory address.
+    mov rax, [rbp-8]
+    push rax
+    .loc 1 117 32
+#----- Load a value from the memory address.
+    mov rax, [rbp-16]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rsi, rax
+    pop rdi
+    mov [rbp-16], rdi
+    mov [rbp-8], rsi
+    jmp .L.body.sum_to
+#----- Epilogue
+.L.return.sum_to:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size sum_to, .-sum_to
+.global is_even
+.type is_even, @function
+is_even:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-8], edi
+.L.body.is_even:
+    .loc 1 122 5
+#----- "If" statement
+    cmp dword ptr [rbp-8], 0
+    jne .L.end.8
+    .loc 1 123 16
+#----- Returns to the caller address.
+    mov rax, 1
+    jmp .L.return.is_even
+.L.end.8:
+#----- Inlined call to is_odd
+#----- Expression statement
+    .loc 1 124 19
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    push rax
+    .loc 1 124 23
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+    .loc 1 127 5
+#----- "If" statement
+    cmp dword ptr [rbp-4], 0
+    jne .L.end.10
+    .loc 1 128 16
+#----- Returns to the caller address.
+    mov rax, 0
+    jmp .L.return.is_even
+.L.end.10:
+#----- Tail call
+    .loc 1 129 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 129 24
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    mov [rbp-8], edi
+    jmp .L.body.is_even
+.L.inline.end.9:
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.is_even:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size is_even, .-is_even
+.global is_odd
+.type is_odd, @function
+is_odd:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-4], edi
+    .loc 1 127 5
+#----- "If" statement
+    cmp dword ptr [rbp-4], 0
+    jne .L.end.11
+    .loc 1 128 16
+#----- Returns to the caller address.
+    mov rax, 0
+    jmp .L.return.is_odd
+.L.end.11:
+#----- Tail call
+    .loc 1 129 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 129 24
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    mov rax, 0
+    .cfi_remember_state
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    jmp is_even
+    .cfi_restore_state
+#----- Epilogue
+.L.return.is_odd:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size is_odd, .-is_odd
+.global tail_in_expr
+.type tail_in_expr, @function
+tail_in_expr:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-16], edi
+#----- Expression statement
+    .loc 1 133 13
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-16]
+    push rax
+    .loc 1 133 17
+    mov rdi, 2
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-12], edi
+    .loc 1 134 12
+    push 1
+#----- Block {...} or Statement expression
+    .loc 1 134 19
+#----- "If" statement
+    cmp dword ptr [rbp-16], 100
+    jle .L.end.12
+#----- Inlined call to add2
+    .loc 1 134 43
+#----- Expression statement
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-16]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-8], edi
+    .loc 1 134 46
+#----- Expression statement
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+    .loc 1 36 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    push rax
+    .loc 1 36 14
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+    jmp .L.return.tail_in_expr
+.L.inline.end.13:
+#----- Returns to the caller address.
+    jmp .L.return.tail_in_expr
+.L.end.12:
+    .loc 1 134 50
+    xor edi, edi
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.tail_in_expr:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size tail_in_expr, .-tail_in_expr
+.global tail_in_cond
+.type tail_in_cond, @function
+tail_in_cond:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-4], edi
+.L.body.tail_in_cond:
+#----- "If" statement
+#----- Block {...} or Statement expression
+    .loc 1 139 11
+#----- "If" statement
+    cmp dword ptr [rbp-4], 0
+    jle .L.end.15
+#----- Tail call
+    .loc 1 139 41
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    push rax
+    .loc 1 139 45
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    mov [rbp-4], edi
+    jmp .L.body.tail_in_cond
+.L.end.15:
+    .loc 1 139 49
+    xor eax, eax
+    test rax, rax
+    je .L.end.14
+    .loc 1 140 16
+#----- Returns to the caller address.
+    mov rax, 7
+    jmp .L.return.tail_in_cond
+.L.end.14:
+    .loc 1 141 12
+#----- Returns to the caller address.
+    mov rax, 3
+#----- Epilogue
+.L.return.tail_in_cond:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size tail_in_cond, .-tail_in_cond
+.global kept_and
+.type kept_and, @function
+kept_and:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-12], edi
+    mov [rbp-8], esi
+#----- Expression statement
+    .loc 1 149 10
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+    test rax, rax
+    je .L.false.16
+    .loc 1 149 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    test rax, rax
+    je .L.false.16
+    push 1
+    jmp .L.end.16
+.L.false.16:
+    push 0
+.L.end.16:
+    .loc 1 149 20
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call unwind_ok
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+    .loc 1 150 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.kept_and:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size kept_and, .-kept_and
+.global kept_or
+.type kept_or, @function
+kept_or:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-12], edi
+    mov [rbp-8], esi
+#----- Expression statement
+    .loc 1 155 10
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+    test rax, rax
+    jne .L.skip.18
+    .loc 1 155 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-8]
+    test rax, rax
+    je .L.false.17
+.L.skip.18:
+    push 1
+    jmp .L.end.17
+.L.false.17:
+    push 0
+.L.end.17:
+    .loc 1 155 20
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call unwind_ok
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+    .loc 1 156 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+#----- Returns to the caller address.
+#----- Epilogue
+.L.return.kept_or:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size kept_or, .-kept_or
+.global pick
+.type pick, @function
+pick:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+    mov [rbp-4], edi
+#----- "If" statement
+    .loc 1 160 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    test rax, rax
+    je .L.end.19
+    .loc 1 161 16
+#----- Returns to the caller address.
+    mov rax, 1
+    jmp .L.return.pick
+.L.end.19:
+    .loc 1 162 12
+#----- Returns to the caller address.
+    mov rax, 2
+#----- Epilogue
+.L.return.pick:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size pick, .-pick
+.global dead_inline_store
+.type dead_inline_store, @function
+dead_inline_store:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 16
+#----- Expression statement
+#----- Inlined call to pick
+    .loc 1 168 14
+#----- Expression statement
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-4], edi
+#----- "If" statement
+    .loc 1 160 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4]
+    test rax, rax
+    je .L.end.21
+    .loc 1 161 16
+#----- Returns to the caller address.
+    mov rax, 1
+    jmp .L.inline.end.20
+.L.end.21:
+    .loc 1 162 12
+#----- Returns to the caller address.
+    mov rax, 2
+.L.inline.end.20:
+    .loc 1 169 12
+#----- Returns to the caller address.
+    mov rax, 4
+#----- Epilogue
+.L.return.dead_inline_store:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size dead_inline_store, .-dead_inline_store
+.global main
+.type main, @function
+main:
+#----- Prologue
+    .cfi_startproc
+    push rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_offset rbp, -16
+    mov rbp, rsp
+    .cfi_def_cfa_register rbp
+    sub rsp, 4960
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 174 12
+#----- Expression statement
+    mov rdi, 1123
+#----- Store a value to the memory address.
+    mov [rbp-912], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 174 56
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4868], edi
+#----- Expression statement
+    .loc 1 174 72
+    lea rax, [rbp-4948]
+    push rax
+    .loc 1 174 74
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4868]
+    mov rdi, rax
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-96], rdi
+    .loc 1 174 50
+#----- "For" statement
+    cmp dword ptr [rbp-4868], 10
+    jge .L.end.23
+    .p2align 4,,10
+.L.begin.23:
+#----- Expression statement
+    .loc 1 174 73
+#----- Load a value from the memory address.
+    mov rax, [rbp-96]
+    push rax
+    .loc 1 174 77
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4868]
+    mov rdi, rax
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 174 66
+#----- Read-modify-write
+    add dword ptr [rbp-4868], 1
+    movsxd rax, dword ptr [rbp-4868]
+    .loc 1 174 65
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-96], 4
+    mov rax, [rbp-96]
+    cmp dword ptr [rbp-4868], 10
+    jl .L.begin.23
+.L.end.23:
+#----- "For" statement
+#----- Expression statement
+    .loc 1 174 86
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4868], edi
+#----- Vectorized loop
+    .loc 1 174 91
+    push 10
+    .loc 1 174 89
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4868]
+    push rax
+    .loc 1 174 102
+    lea rax, [rbp-4908]
+    push rax
+    .loc 1 174 107
+    lea rax, [rbp-4948]
+    push rax
+    .loc 1 174 112
+    mov rax, 3
+    pop rsi
+    pop rdi
+    pop rcx
+    pop r8
+    movd xmm1, eax
+    pshufd xmm1, xmm1, 0
+    .p2align 4,,10
+.L.vec.begin.25:
+    lea rax, [rcx+4]
+    cmp rax, r8
+    jg .L.vec.end.25
+    movdqu xmm0, [rsi+rcx*4]
+    paddd xmm0, xmm1
+    movdqu [rdi+rcx*4], xmm0
+    mov rcx, rax
+    jmp .L.vec.begin.25
+.L.vec.end.25:
+    mov rdi, rcx
+#----- Store a value to the memory address.
+    mov [rbp-4868], edi
+    cmp dword ptr [rbp-4868], 10
+    jge .L.end.24
+    .p2align 4,,10
+.L.begin.24:
+#----- Expression statement
+    .loc 1 174 104
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4868]
+    push rax
+#----- Load a value from the memory address.
+    .loc 1 174 109
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4868]
+    mov rdx, rax
+    movsxd rax, dword ptr [rbp+rdx*4-4948]
+    push rax
+    .loc 1 174 112
+    mov rdi, 3
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-4908], edi
+#----- Expression statement
+    .loc 1 174 96
+#----- Read-modify-write
+    add dword ptr [rbp-4868], 1
+    movsxd rax, dword ptr [rbp-4868]
+    cmp dword ptr [rbp-4868], 10
+    jl .L.begin.24
+.L.end.24:
+    .loc 1 174 116
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4908]
+    push rax
+    .loc 1 174 121
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4872]
+    push rax
+    .loc 1 174 125
+    mov rdi, 10
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 174 128
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4868]
+    push rax
+    .loc 1 174 130
+    mov rdi, 100
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-908], edi
+    .loc 1 174 139
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.2
+#----- Store a value to the memory address.
+    mov [rbp-904], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-912]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-908]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.26
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-904]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-908]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.26
+.L.else.26:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-904]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-912]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-908]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.26:
+.L.inline.end.22:
+#----- Expression statement
+#----- Inlined call to assert
+#----- Expression statement
+    .loc 1 175 12
+    push 0
+    .loc 1 175 14
+    mov rdi, 171
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-896], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 175 47
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4840], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 175 56
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4844], edi
+#----- Expression statement
+    .loc 1 175 72
+    lea rax, [rbp-4864]
+    push rax
+    .loc 1 175 74
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4844]
+    mov rdi, rax
+    pop rax
+    imul rdi, 1
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-88], rdi
+    .loc 1 175 50
+#----- "For" statement
+    cmp dword ptr [rbp-4844], 20
+    jge .L.end.28
+    .p2align 4,,10
+.L.begin.28:
+#----- Expression statement
+    .loc 1 175 73
+#----- Load a value from the memory address.
+    mov rax, [rbp-88]
+    push rax
+    .loc 1 175 77
+    push 0
+    .loc 1 175 79
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4844]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], dil
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 175 66
+#----- Read-modify-write
+    add dword ptr [rbp-4844], 1
+    movsxd rax, dword ptr [rbp-4844]
+    .loc 1 175 65
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-88], 1
+    mov rax, [rbp-88]
+    cmp dword ptr [rbp-4844], 20
+    jl .L.begin.28
+.L.end.28:
+#----- "For" statement
+#----- Expression statement
+    .loc 1 175 88
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4844], edi
+#----- Vectorized loop
+    .loc 1 175 93
+    push 19
+    .loc 1 175 91
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4844]
+    push rax
+    .loc 1 175 108
+    lea rax, [rbp-4864]
+    mov rsi, rax
+    pop rcx
+    pop r8
+    pxor xmm2, xmm2
+    .p2align 4,,10
+.L.vec.begin.30:
+    lea rax, [rcx+16]
+    cmp rax, r8
+    jg .L.vec.end.30
+    movdqu xmm0, [rsi+rcx*1]
+    movdqa xmm3, xmm0
+    punpcklbw xmm3, xmm3
+    psraw xmm3, 8
+    punpckhbw xmm0, xmm0
+    psraw xmm0, 8
+    movdqa xmm4, xmm3
+    punpcklwd xmm4, xmm4
+    psrad xmm4, 16
+    paddd xmm2, xmm4
+    punpckhwd xmm3, xmm3
+    psrad xmm3, 16
+    paddd xmm2, xmm3
+    movdqa xmm4, xmm0
+    punpcklwd xmm4, xmm4
+    psrad xmm4, 16
+    paddd xmm2, xmm4
+    punpckhwd xmm0, xmm0
+    psrad xmm0, 16
+    paddd xmm2, xmm0
+    mov rcx, rax
+    jmp .L.vec.begin.30
+.L.vec.end.30:
+    mov rdi, rcx
+#----- Store a value to the memory address.
+    mov [rbp-4844], edi
+    pshufd xmm0, xmm2, 0x4e
+    paddd xmm2, xmm0
+    pshufd xmm0, xmm2, 0xb1
+    paddd xmm2, xmm0
+    movd ecx, xmm2
+    .loc 1 175 104
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4840]
+    mov rdi, rax
+    add ecx, edi
+    movsxd rcx, ecx
+    mov rdi, rcx
+#----- Store a value to the memory address.
+    mov [rbp-4840], edi
+    cmp dword ptr [rbp-4844], 19
+    jge .L.end.29
+    .p2align 4,,10
+.L.begin.29:
+#----- Expression statement
+#----- Read-modify-write
+#----- Load a value from the memory address.
+    .loc 1 175 110
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4844]
+    mov rdx, rax
+    movsx rax, byte ptr [rbp+rdx*1-4864]
+    mov rdi, rax
+    add [rbp-4840], edi
+    movsxd rax, dword ptr [rbp-4840]
+#----- Expression statement
+    .loc 1 175 98
+#----- Read-modify-write
+    add dword ptr [rbp-4844], 1
+    movsxd rax, dword ptr [rbp-4844]
+    cmp dword ptr [rbp-4844], 19
+    jl .L.begin.29
+.L.end.29:
+    .loc 1 175 114
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4840]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-892], edi
+    .loc 1 175 121
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.3
+#----- Store a value to the memory address.
+    mov [rbp-888], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-896]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-892]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.31
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-888]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-892]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.31
+.L.else.31:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-888]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-896]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-892]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.31:
+.L.inline.end.27:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 176 12
+#----- Expression statement
+    mov rdi, 14
+#----- Store a value to the memory address.
+    mov [rbp-880], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 176 56
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4800], edi
+#----- Expression statement
+    .loc 1 176 72
+    lea rax, [rbp-4834]
+    push rax
+    .loc 1 176 74
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4800]
+    mov rdi, rax
+    pop rax
+    imul rdi, 1
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-80], rdi
+    .loc 1 176 50
+#----- "For" statement
+    cmp dword ptr [rbp-4800], 17
+    jge .L.end.33
+    .p2align 4,,10
+.L.begin.33:
+#----- Expression statement
+    .loc 1 176 73
+#----- Load a value from the memory address.
+    mov rax, [rbp-80]
+    push rax
+    .loc 1 176 77
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4800]
+    mov rdi, rax
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], dil
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 176 66
+#----- Read-modify-write
+    add dword ptr [rbp-4800], 1
+    movsxd rax, dword ptr [rbp-4800]
+    .loc 1 176 65
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-80], 1
+    mov rax, [rbp-80]
+    cmp dword ptr [rbp-4800], 17
+    jl .L.begin.33
+.L.end.33:
+#----- "For" statement
+#----- Expression statement
+    .loc 1 176 86
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4800], edi
+#----- Vectorized loop
+    .loc 1 176 91
+    push 17
+    .loc 1 176 89
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4800]
+    push rax
+    .loc 1 176 102
+    lea rax, [rbp-4817]
+    push rax
+    .loc 1 176 107
+    lea rax, [rbp-4834]
+    push rax
+    .loc 1 176 112
+    mov rax, 1
+    pop rsi
+    pop rdi
+    pop rcx
+    pop r8
+    movd xmm1, eax
+    punpcklbw xmm1, xmm1
+    punpcklwd xmm1, xmm1
+    pshufd xmm1, xmm1, 0
+    .p2align 4,,10
+.L.vec.begin.35:
+    lea rax, [rcx+16]
+    cmp rax, r8
+    jg .L.vec.end.35
+    movdqu xmm0, [rsi+rcx*1]
+    psubb xmm0, xmm1
+    movdqu [rdi+rcx*1], xmm0
+    mov rcx, rax
+    jmp .L.vec.begin.35
+.L.vec.end.35:
+    mov rdi, rcx
+#----- Store a value to the memory address.
+    mov [rbp-4800], edi
+    cmp dword ptr [rbp-4800], 17
+    jge .L.end.34
+    .p2align 4,,10
+.L.begin.34:
+#----- Expression statement
+    .loc 1 176 104
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4800]
+    push rax
+#----- Load a value from the memory address.
+    .loc 1 176 109
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4800]
+    mov rdx, rax
+    movsx rax, byte ptr [rbp+rdx*1-4834]
+    push rax
+    .loc 1 176 112
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*1-4817], dil
+#----- Expression statement
+    .loc 1 176 96
+#----- Read-modify-write
+    add dword ptr [rbp-4800], 1
+    movsxd rax, dword ptr [rbp-4800]
+    cmp dword ptr [rbp-4800], 17
+    jl .L.begin.34
+.L.end.34:
+    .loc 1 176 116
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-4801]
+    push rax
+    .loc 1 176 122
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-4817]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-876], edi
+    .loc 1 176 131
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.4
+#----- Store a value to the memory address.
+    mov [rbp-872], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-880]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-876]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.36
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-872]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-876]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.36
+.L.else.36:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-872]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-880]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-876]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.36:
+.L.inline.end.32:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 177 12
+#----- Expression statement
+    mov rdi, 1024
+#----- Store a value to the memory address.
+    mov [rbp-864], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 177 45
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4748], edi
+#----- Expression statement
+    .loc 1 177 61
+    lea rax, [rbp-4796]
+    push rax
+    .loc 1 177 63
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4748]
+    mov rdi, rax
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-72], rdi
+    .loc 1 177 39
+#----- "For" statement
+    cmp dword ptr [rbp-4748], 12
+    jge .L.end.38
+    .p2align 4,,10
+.L.begin.38:
+#----- Expression statement
+    .loc 1 177 62
+#----- Load a value from the memory address.
+    mov rax, [rbp-72]
+    push rax
+    .loc 1 177 66
+    mov rdi, 1
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 177 55
+#----- Read-modify-write
+    add dword ptr [rbp-4748], 1
+    movsxd rax, dword ptr [rbp-4748]
+    .loc 1 177 54
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-72], 4
+    mov rax, [rbp-72]
+    cmp dword ptr [rbp-4748], 12
+    jl .L.begin.38
+.L.end.38:
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 177 77
+    lea rax, [rbp-4796]
+    push rax
+    .loc 1 177 79
+    mov rdi, 1
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    push rax
+    .loc 1 177 82
+    lea rax, [rbp-4796]
+    push rax
+    .loc 1 177 85
+    lea rax, [rbp-4796]
+    push rax
+    .loc 1 177 88
+#-- 引数をレジスタにセット 
+    mov rcx, 10
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call vec_add
+    .loc 1 177 94
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4756]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-860], edi
+    .loc 1 177 104
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.5
+#----- Store a value to the memory address.
+    mov [rbp-856], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-864]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-860]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.39
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-856]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-860]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.39
+.L.else.39:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-856]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-864]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-860]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.39:
+.L.inline.end.37:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 178 12
+#----- Expression statement
+    mov rdi, 22
+#----- Store a value to the memory address.
+    mov [rbp-848], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 178 43
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4696], edi
+#----- Expression statement
+    .loc 1 178 59
+    lea rax, [rbp-4744]
+    push rax
+    .loc 1 178 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4696]
+    mov rdi, rax
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-64], rdi
+    .loc 1 178 37
+#----- "For" statement
+    cmp dword ptr [rbp-4696], 12
+    jge .L.end.41
+    .p2align 4,,10
+.L.begin.41:
+#----- Expression statement
+    .loc 1 178 60
+#----- Load a value from the memory address.
+    mov rax, [rbp-64]
+    push rax
+    .loc 1 178 64
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4696]
+    mov rdi, rax
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 178 53
+#----- Read-modify-write
+    add dword ptr [rbp-4696], 1
+    movsxd rax, dword ptr [rbp-4696]
+    .loc 1 178 52
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-64], 4
+    mov rax, [rbp-64]
+    cmp dword ptr [rbp-4696], 12
+    jl .L.begin.41
+.L.end.41:
+#----- Function call with up to 6 parameters. 
+    .loc 1 178 75
+    lea rax, [rbp-4744]
+    push rax
+    .loc 1 178 78
+    lea rax, [rbp-4744]
+    push rax
+    .loc 1 178 80
+    mov rdi, 4
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    push rax
+    .loc 1 178 83
+    lea rax, [rbp-4744]
+    push rax
+    .loc 1 178 85
+    mov rdi, 4
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    push rax
+    .loc 1 178 88
+#-- 引数をレジスタにセット 
+    mov rcx, 8
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call vec_add
+    push rax
+    .loc 1 178 92
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4732]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-844], edi
+    .loc 1 178 101
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.6
+#----- Store a value to the memory address.
+    mov [rbp-840], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-848]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-844]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.42
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-840]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-844]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.42
+.L.else.42:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-840]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-848]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-844]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.42:
+.L.inline.end.40:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 180 12
+#----- Expression statement
+    mov rdi, 13
+#----- Store a value to the memory address.
+    mov [rbp-832], edi
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 180 26
+#-- 引数をレジスタにセット 
+    mov rdi, 6
+    xor eax, eax
+    call dead_code
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-828], edi
+    .loc 1 180 30
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.7
+#----- Store a value to the memory address.
+    mov [rbp-824], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-832]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-828]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.44
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-824]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-828]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.44
+.L.else.44:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-824]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-832]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-828]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.44:
+.L.inline.end.43:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 181 12
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-816], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 181 24
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-4692], edi
+    .loc 1 181 38
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4692]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-812], edi
+    .loc 1 181 45
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.8
+#----- Store a value to the memory address.
+    mov [rbp-808], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-816]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-812]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.46
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-808]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-812]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.46
+.L.else.46:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-808]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-816]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-812]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.46:
+.L.inline.end.45:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 182 12
+#----- Expression statement
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-800], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 182 24
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-4688], edi
+#----- Expression statement
+    .loc 1 182 37
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-4688], edi
+    .loc 1 182 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4688]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-796], edi
+    .loc 1 182 57
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.9
+#----- Store a value to the memory address.
+    mov [rbp-792], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-800]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-796]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.48
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-792]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-796]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.48
+.L.else.48:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-792]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-800]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-796]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.48:
+.L.inline.end.47:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 183 12
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-784], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 183 24
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-4684], edi
+    .loc 1 183 41
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4684]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-780], edi
+    .loc 1 183 48
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.10
+#----- Store a value to the memory address.
+    mov [rbp-776], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-784]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-780]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.50
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-776]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-780]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.50
+.L.else.50:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-776]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-784]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-780]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.50:
+.L.inline.end.49:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 184 12
+#----- Expression statement
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-768], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 184 24
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-4680], edi
+#----- Expression statement
+    .loc 1 184 33
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-4680], edi
+    .loc 1 184 45
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4680]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-764], edi
+    .loc 1 184 52
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.11
+#----- Store a value to the memory address.
+    mov [rbp-760], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-768]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-764]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.52
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-760]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-764]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.52
+.L.else.52:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-760]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-768]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-764]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.52:
+.L.inline.end.51:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 186 12
+#----- Expression statement
+    mov rdi, 37
+#----- Store a value to the memory address.
+    mov [rbp-752], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 186 34
+    mov rdi, 6
+#----- Store a value to the memory address.
+    mov [rbp-4668], edi
+#----- Expression statement
+    .loc 1 186 43
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-4660], edi
+#----- Expression statement
+#----- Load a value from the memory address.
+    .loc 1 186 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4660]
+    mov rdx, rax
+    movsxd rax, dword ptr [rbp+rdx*4-4676]
+    push rax
+    .loc 1 186 57
+    mov rdi, 3
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-32], rdi
+#----- Store a value to the memory address.
+    mov [rbp-4656], edi
+#----- Expression statement
+    .loc 1 186 70
+#----- Load a value from the memory address.
+    mov rax, [rbp-32]
+    push rax
+    .loc 1 186 73
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4652], edi
+    .loc 1 186 76
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4656]
+    push rax
+    .loc 1 186 78
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4652]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-748], edi
+    .loc 1 186 85
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.12
+#----- Store a value to the memory address.
+    mov [rbp-744], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-752]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-748]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.54
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-744]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-748]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.54
+.L.else.54:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-744]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-752]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-748]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.54:
+.L.inline.end.53:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 187 12
+#----- Expression statement
+    mov rdi, 18
+#----- Store a value to the memory address.
+    mov [rbp-736], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 187 34
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-4648], edi
+#----- Expression statement
+    .loc 1 187 43
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4640], edi
+#----- Expression statement
+#----- Load a value from the memory address.
+    .loc 1 187 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4640]
+    mov rdx, rax
+    movsxd rax, dword ptr [rbp+rdx*4-4648]
+    push rax
+    .loc 1 187 57
+    mov rdi, 2
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4636], edi
+#----- Expression statement
+    .loc 1 187 65
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-4648], edi
+    .loc 1 187 68
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4636]
+    push rax
+#----- Load a value from the memory address.
+    .loc 1 187 72
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4640]
+    mov rdx, rax
+    movsxd rax, dword ptr [rbp+rdx*4-4648]
+    push rax
+    .loc 1 187 75
+    mov rdi, 2
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-732], edi
+    .loc 1 187 82
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.13
+#----- Store a value to the memory address.
+    mov [rbp-728], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-736]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-732]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.56
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-728]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-732]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.56
+.L.else.56:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-728]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-736]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-732]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.56:
+.L.inline.end.55:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 188 12
+#----- Expression statement
+    mov rdi, 49
+#----- Store a value to the memory address.
+    mov [rbp-712], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 188 34
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-4632], edi
+#----- Expression statement
+    .loc 1 188 44
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4632]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-20], edi
+    push rdi
+    .loc 1 188 49
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-20]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4628], edi
+#----- Expression statement
+#----- Inlined call to bump
+    .loc 1 188 59
+#----- Expression statement
+    lea rax, [rbp-4632]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-720], rdi
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 93 6
+#----- Load a value from the memory address.
+    mov rax, [rbp-720]
+    add dword ptr [rax], 1
+    movsxd rax, dword ptr [rax]
+    .loc 1 94 12
+#----- Returns to the caller address.
+    mov rax, 0
+.L.inline.end.58:
+    .loc 1 188 63
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4628]
+    push rax
+    .loc 1 188 65
+    mov rdi, 10
+    pop rax
+    imul rax, rdi
+    push rax
+    .loc 1 188 69
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4632]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-16], edi
+    push rdi
+    .loc 1 188 74
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-16]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-708], edi
+    .loc 1 188 83
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.14
+#----- Store a value to the memory address.
+    mov [rbp-704], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-712]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-708]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.59
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-704]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-708]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.59
+.L.else.59:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-704]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-712]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-708]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.59:
+.L.inline.end.57:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 189 12
+#----- Expression statement
+    mov rdi, 12
+#----- Store a value to the memory address.
+    mov [rbp-696], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 189 25
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-4624], edi
+#----- Expression statement
+    .loc 1 189 34
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-4620], edi
+#----- Expression statement
+    .loc 1 189 43
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4624]
+    push rax
+    .loc 1 189 45
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4620]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4616], edi
+#----- Expression statement
+    .loc 1 189 50
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-4624], edi
+    .loc 1 189 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4616]
+    push rax
+    .loc 1 189 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4624]
+    push rax
+    .loc 1 189 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4620]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-692], edi
+    .loc 1 189 64
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.15
+#----- Store a value to the memory address.
+    mov [rbp-688], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-696]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-692]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.61
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-688]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-692]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.61
+.L.else.61:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-688]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-696]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-692]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.61:
+.L.inline.end.60:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 190 12
+#----- Expression statement
+    mov rdi, 12
+#----- Store a value to the memory address.
+    mov [rbp-680], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 190 25
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-4612], edi
+#----- Expression statement
+    .loc 1 190 34
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-4608], edi
+#----- Expression statement
+    .loc 1 190 43
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4604], edi
+    .loc 1 190 46
+#----- "If" statement
+    cmp dword ptr [rbp-4612], 5
+    jle .L.end.63
+#----- Expression statement
+    .loc 1 190 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4612]
+    push rax
+    .loc 1 190 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4608]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4604], edi
+.L.end.63:
+    .loc 1 190 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4604]
+    push rax
+    .loc 1 190 63
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4612]
+    push rax
+    .loc 1 190 65
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4608]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-676], edi
+    .loc 1 190 72
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.16
+#----- Store a value to the memory address.
+    mov [rbp-672], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-680]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-676]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.64
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-672]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-676]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.64
+.L.else.64:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-672]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-680]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-676]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.64:
+.L.inline.end.62:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 191 12
+#----- Expression statement
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-664], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 191 24
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4600], edi
+#----- Expression statement
+    .loc 1 191 33
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-4596], edi
+    .loc 1 191 37
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4600]
+    test rax, rax
+    je .L.false.66
+    .loc 1 191 42
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4600]
+    push rax
+    .loc 1 191 44
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4596]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    test rax, rax
+    je .L.false.66
+    push 1
+    jmp .L.end.66
+.L.false.66:
+    push 0
+.L.end.66:
+    .loc 1 191 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4600]
+    push rax
+    .loc 1 191 52
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 191 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4596]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-660], edi
+    .loc 1 191 62
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.17
+#----- Store a value to the memory address.
+    mov [rbp-656], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-664]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-660]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.67
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-656]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-660]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.67
+.L.else.67:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-656]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-664]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-660]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.67:
+.L.inline.end.65:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 193 12
+#----- Expression statement
+    mov rdi, 168
+#----- Store a value to the memory address.
+    mov [rbp-648], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 193 35
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-4592], edi
+#----- Expression statement
+    .loc 1 193 43
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-4588], edi
+#----- Expression statement
+    .loc 1 193 51
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-4584], edi
+#----- Expression statement
+    .loc 1 193 59
+    mov rdi, 9
+#----- Store a value to the memory address.
+    mov [rbp-4580], edi
+#----- Expression statement
+    .loc 1 193 68
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4576], edi
+#----- Expression statement
+    .loc 1 193 77
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-4572], edi
+#----- Expression statement
+    .loc 1 193 86
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4568], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 193 106
+    lea rax, [rbp-4592]
+    push rax
+    .loc 1 193 108
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4576]
+    mov rdi, rax
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-56], rdi
+    .loc 1 193 89
+#----- "While" statement
+    cmp dword ptr [rbp-4576], 4
+    jge .L.end.69
+    .p2align 4,,10
+.L.begin.69:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 193 107
+#----- Load a value from the memory address.
+#----- Load a value from the memory address.
+    mov rax, [rbp-56]
+    movsxd rax, dword ptr [rax]
+    push rax
+#----- Load a value from the memory address.
+    .loc 1 193 113
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4572]
+    mov rdx, rax
+    movsxd rax, dword ptr [rbp+rdx*4-4592]
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    add [rbp-4568], edi
+    movsxd rax, dword ptr [rbp-4568]
+#----- Expression statement
+    .loc 1 193 118
+#----- Read-modify-write
+    add dword ptr [rbp-4576], 1
+    movsxd rax, dword ptr [rbp-4576]
+    .loc 1 193 117
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-56], 4
+    mov rax, [rbp-56]
+    cmp dword ptr [rbp-4576], 4
+    jl .L.begin.69
+.L.end.69:
+    .loc 1 193 126
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4568]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-644], edi
+    .loc 1 193 133
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.18
+#----- Store a value to the memory address.
+    mov [rbp-640], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-648]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-644]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.70
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-640]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-644]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.70
+.L.else.70:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-640]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-648]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-644]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.70:
+.L.inline.end.68:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 194 12
+#----- Expression statement
+    mov rdi, 6
+#----- Store a value to the memory address.
+    mov [rbp-632], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 194 33
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-4564], edi
+#----- Expression statement
+    .loc 1 194 41
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-4560], edi
+#----- Expression statement
+    .loc 1 194 49
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-4556], edi
+#----- Expression statement
+    .loc 1 194 58
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4552], edi
+#----- Expression statement
+    .loc 1 194 67
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4548], edi
+    .loc 1 194 70
+#----- "While" statement
+    cmp dword ptr [rbp-4552], 3
+    jge .L.end.72
+    .p2align 4,,10
+.L.begin.72:
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 194 85
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4548]
+    push rax
+    .loc 1 194 88
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4564]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-12], edi
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4548], edi
+#----- Expression statement
+    .loc 1 194 99
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-12]
+    push rax
+    .loc 1 194 103
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4564], edi
+#----- Expression statement
+    .loc 1 194 107
+#----- Read-modify-write
+    add dword ptr [rbp-4552], 1
+    movsxd rax, dword ptr [rbp-4552]
+    cmp dword ptr [rbp-4552], 3
+    jl .L.begin.72
+.L.end.72:
+    .loc 1 194 115
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4548]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-628], edi
+    .loc 1 194 122
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.19
+#----- Store a value to the memory address.
+    mov [rbp-624], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-632]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-628]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.73
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-624]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-628]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.73
+.L.else.73:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-624]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-632]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-628]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.73:
+.L.inline.end.71:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 195 12
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-616], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 195 25
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4544], rdi
+#----- Expression statement
+    .loc 1 195 34
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4536], edi
+#----- Expression statement
+    .loc 1 195 43
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4532], edi
+    .loc 1 195 46
+#----- "While" statement
+    cmp dword ptr [rbp-4536], 0
+    jge .L.end.75
+    .p2align 4,,10
+.L.begin.75:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Read-modify-write
+#----- Load a value from the memory address.
+    .loc 1 195 64
+#----- Load a value from the memory address.
+    mov rax, [rbp-4544]
+    movsxd rax, dword ptr [rax]
+    mov rdi, rax
+    add [rbp-4532], edi
+    movsxd rax, dword ptr [rbp-4532]
+#----- Expression statement
+    .loc 1 195 68
+#----- Read-modify-write
+    add dword ptr [rbp-4536], 1
+    movsxd rax, dword ptr [rbp-4536]
+    cmp dword ptr [rbp-4536], 0
+    jl .L.begin.75
+.L.end.75:
+    .loc 1 195 76
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4532]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-612], edi
+    .loc 1 195 83
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.20
+#----- Store a value to the memory address.
+    mov [rbp-608], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-616]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-612]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.76
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-608]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-612]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.76
+.L.else.76:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-608]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-616]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-612]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.76:
+.L.inline.end.74:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 196 12
+#----- Expression statement
+    mov rdi, 9
+#----- Store a value to the memory address.
+    mov [rbp-600], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 196 41
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4504], edi
+#----- Expression statement
+    .loc 1 196 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    push rax
+    .loc 1 196 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-4528], edi
+#----- Expression statement
+    .loc 1 196 50
+#----- Read-modify-write
+    add dword ptr [rbp-4504], 1
+    movsxd rax, dword ptr [rbp-4504]
+#----- Expression statement
+    .loc 1 196 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    push rax
+    .loc 1 196 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-4528], edi
+#----- Expression statement
+    .loc 1 196 50
+#----- Read-modify-write
+    add dword ptr [rbp-4504], 1
+    movsxd rax, dword ptr [rbp-4504]
+#----- Expression statement
+    .loc 1 196 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    push rax
+    .loc 1 196 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-4528], edi
+#----- Expression statement
+    .loc 1 196 50
+#----- Read-modify-write
+    add dword ptr [rbp-4504], 1
+    movsxd rax, dword ptr [rbp-4504]
+#----- Expression statement
+    .loc 1 196 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    push rax
+    .loc 1 196 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-4528], edi
+#----- Expression statement
+    .loc 1 196 50
+#----- Read-modify-write
+    add dword ptr [rbp-4504], 1
+    movsxd rax, dword ptr [rbp-4504]
+#----- Expression statement
+    .loc 1 196 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    push rax
+    .loc 1 196 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-4528], edi
+#----- Expression statement
+    .loc 1 196 50
+#----- Read-modify-write
+    add dword ptr [rbp-4504], 1
+    movsxd rax, dword ptr [rbp-4504]
+#----- Expression statement
+    .loc 1 196 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    push rax
+    .loc 1 196 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    mov rdi, rax
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-4528], edi
+#----- Expression statement
+    .loc 1 196 50
+#----- Read-modify-write
+    add dword ptr [rbp-4504], 1
+    movsxd rax, dword ptr [rbp-4504]
+#----- Expression statement
+    .loc 1 196 70
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4500], edi
+#----- Expression statement
+    .loc 1 196 75
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-4504], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 196 95
+    lea rax, [rbp-4528]
+    push rax
+    .loc 1 196 97
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4504]
+    mov rdi, rax
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-48], rdi
+    .loc 1 196 78
+#----- "While" statement
+    cmp dword ptr [rbp-4504], 6
+    jge .L.end.78
+    .p2align 4,,10
+.L.begin.78:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 196 96
+#----- Load a value from the memory address.
+#----- Load a value from the memory address.
+    mov rax, [rbp-48]
+    movsxd rax, dword ptr [rax]
+    mov rdi, rax
+    add [rbp-4500], edi
+    movsxd rax, dword ptr [rbp-4500]
+#----- Expression statement
+    .loc 1 196 102
+#----- Read-modify-write
+    add dword ptr [rbp-4504], 2
+    movsxd rax, dword ptr [rbp-4504]
+    .loc 1 196 101
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-48], 8
+    mov rax, [rbp-48]
+    cmp dword ptr [rbp-4504], 6
+    jl .L.begin.78
+.L.end.78:
+    .loc 1 196 110
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4500]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-596], edi
+    .loc 1 196 117
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.21
+#----- Store a value to the memory address.
+    mov [rbp-592], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-600]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-596]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.79
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-592]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-596]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.79
+.L.else.79:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-592]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-600]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-596]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.79:
+.L.inline.end.77:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 198 12
+#----- Expression statement
+    mov rdi, 105
+#----- Store a value to the memory address.
+    mov [rbp-584], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 198 33
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4492], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 198 42
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4496], edi
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 198 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4496]
+    mov rdi, rax
+    add [rbp-4492], edi
+    movsxd rax, dword ptr [rbp-4492]
+#----- Expression statement
+    .loc 1 198 51
+#----- Read-modify-write
+    add dword ptr [rbp-4496], 1
+    movsxd rax, dword ptr [rbp-4496]
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 198 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4496]
+    mov rdi, rax
+    add [rbp-4492], edi
+    movsxd rax, dword ptr [rbp-4492]
+#----- Expression statement
+    .loc 1 198 51
+#----- Read-modify-write
+    add dword ptr [rbp-4496], 1
+    movsxd rax, dword ptr [rbp-4496]
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 198 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4496]
+    mov rdi, rax
+    add [rbp-4492], edi
+    movsxd rax, dword ptr [rbp-4492]
+#----- Expression statement
+    .loc 1 198 51
+#----- Read-modify-write
+    add dword ptr [rbp-4496], 1
+    movsxd rax, dword ptr [rbp-4496]
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 198 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4496]
+    mov rdi, rax
+    add [rbp-4492], edi
+    movsxd rax, dword ptr [rbp-4492]
+#----- Expression statement
+    .loc 1 198 51
+#----- Read-modify-write
+    add dword ptr [rbp-4496], 1
+    movsxd rax, dword ptr [rbp-4496]
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 198 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4496]
+    mov rdi, rax
+    add [rbp-4492], edi
+    movsxd rax, dword ptr [rbp-4492]
+#----- Expression statement
+    .loc 1 198 51
+#----- Read-modify-write
+    add dword ptr [rbp-4496], 1
+    movsxd rax, dword ptr [rbp-4496]
+    .loc 1 198 64
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4492]
+    push rax
+    .loc 1 198 66
+    mov rdi, 10
+    pop rax
+    imul rax, rdi
+    push rax
+    .loc 1 198 69
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4496]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-580], edi
+    .loc 1 198 76
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.22
+#----- Store a value to the memory address.
+    mov [rbp-576], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-584]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-580]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.81
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-576]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-580]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.81
+.L.else.81:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-576]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-584]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-580]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.81:
+.L.inline.end.80:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 199 12
+#----- Expression statement
+    mov rdi, 66
+#----- Store a value to the memory address.
+    mov [rbp-568], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 199 32
+    mov rdi, 11
+#----- Store a value to the memory address.
+    mov [rbp-4484], edi
+#----- Expression statement
+    .loc 1 199 42
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4480], edi
+#----- "For" statement
+#----- Expression statement
+    .loc 1 199 51
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4488], edi
+    .loc 1 199 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4488]
+    push rax
+    .loc 1 199 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4484]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jge .L.end.83
+    .p2align 4,,10
+.L.begin.83:
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 199 70
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4488]
+    mov rdi, rax
+    add [rbp-4480], edi
+    movsxd rax, dword ptr [rbp-4480]
+#----- Expression statement
+    .loc 1 199 60
+#----- Read-modify-write
+    add dword ptr [rbp-4488], 1
+    movsxd rax, dword ptr [rbp-4488]
+    .loc 1 199 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4488]
+    push rax
+    .loc 1 199 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4484]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jl .L.begin.83
+.L.end.83:
+    .loc 1 199 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4480]
+    push rax
+    .loc 1 199 75
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4488]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-564], edi
+    .loc 1 199 82
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.23
+#----- Store a value to the memory address.
+    mov [rbp-560], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-568]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-564]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.84
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-560]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-564]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.84
+.L.else.84:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-560]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-568]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-564]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.84:
+.L.inline.end.82:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 200 12
+#----- Expression statement
+    mov rdi, 2213
+#----- Store a value to the memory address.
+    mov [rbp-552], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 200 34
+    mov rdi, 10
+#----- Store a value to the memory address.
+    mov [rbp-4472], edi
+#----- Expression statement
+    .loc 1 200 44
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4468], edi
+#----- "For" statement
+#----- Expression statement
+    .loc 1 200 53
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-4476], edi
+    .loc 1 200 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4476]
+    push rax
+    .loc 1 200 59
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4472]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jg .L.end.86
+    .p2align 4,,10
+.L.begin.86:
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 200 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4476]
+    mov rdi, rax
+    add [rbp-4468], edi
+    movsxd rax, dword ptr [rbp-4468]
+#----- Expression statement
+    .loc 1 200 63
+#----- Read-modify-write
+    add dword ptr [rbp-4476], 3
+    movsxd rax, dword ptr [rbp-4476]
+    .loc 1 200 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4476]
+    push rax
+    .loc 1 200 59
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4472]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jle .L.begin.86
+.L.end.86:
+    .loc 1 200 76
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4468]
+    push rax
+    .loc 1 200 78
+    mov rdi, 100
+    pop rax
+    imul rax, rdi
+    push rax
+    .loc 1 200 82
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4476]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-548], edi
+    .loc 1 200 89
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.24
+#----- Store a value to the memory address.
+    mov [rbp-544], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-552]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-548]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.87
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-544]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-548]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.87
+.L.else.87:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-544]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-552]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-548]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.87:
+.L.inline.end.85:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 201 12
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-536], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 201 31
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4460], edi
+#----- Expression statement
+    .loc 1 201 40
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4456], edi
+#----- "For" statement
+#----- Expression statement
+    .loc 1 201 49
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4464], edi
+    .loc 1 201 52
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4464]
+    push rax
+    .loc 1 201 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4460]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jge .L.end.89
+    .p2align 4,,10
+.L.begin.89:
+#----- Expression statement
+    .loc 1 201 65
+#----- Read-modify-write
+    add dword ptr [rbp-4456], 1
+    movsxd rax, dword ptr [rbp-4456]
+#----- Expression statement
+    .loc 1 201 58
+#----- Read-modify-write
+    add dword ptr [rbp-4464], 1
+    movsxd rax, dword ptr [rbp-4464]
+    .loc 1 201 52
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4464]
+    push rax
+    .loc 1 201 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4460]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jl .L.begin.89
+.L.end.89:
+    .loc 1 201 71
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4456]
+    push rax
+    .loc 1 201 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4464]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-532], edi
+    .loc 1 201 80
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.25
+#----- Store a value to the memory address.
+    mov [rbp-528], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-536]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-532]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.90
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-528]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-532]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.90
+.L.else.90:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-528]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-536]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-532]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.90:
+.L.inline.end.88:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 203 12
+#----- Expression statement
+    mov rdi, 50005000
+#----- Store a value to the memory address.
+    mov [rbp-504], edi
+#----- Expression statement
+#----- Inlined call to sum_to
+    .loc 1 203 29
+#----- Expression statement
+    mov rdi, 10000
+#----- Store a value to the memory address.
+    mov [rbp-520], rdi
+    .loc 1 203 36
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-512], rdi
+    .loc 1 115 5
+#----- "If" statement
+    cmp qword ptr [rbp-520], 0
+    jne .L.end.93
+    .loc 1 116 16
+#----- Load a value from the memory address.
+    mov rax, [rbp-512]
+#----- Returns to the caller address.
+    jmp .L.inline.end.92
+.L.end.93:
+#----- Function call with up to 6 parameters. 
+    .loc 1 117 19
+#----- Load a value from the memory address.
+    mov rax, [rbp-520]
+    push rax
+    .loc 1 117 23
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 117 26
+#----- Load a value from the memory address.
+    mov rax, [rbp-512]
+    push rax
+    .loc 1 117 32
+#----- Load a value from the memory address.
+    mov rax, [rbp-520]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+#-- 引数をレジスタにセット 
+    mov rsi, rax
+    pop rdi
+    xor eax, eax
+    call sum_to
+#----- Returns to the caller address.
+.L.inline.end.92:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-500], edi
+    .loc 1 203 40
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.26
+#----- Store a value to the memory address.
+    mov [rbp-496], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-504]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-500]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.94
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-496]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-500]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.94
+.L.else.94:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-496]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-504]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-500]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.94:
+.L.inline.end.91:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 204 12
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-480], edi
+#----- Expression statement
+#----- Inlined call to is_odd
+    .loc 1 204 22
+#----- Expression statement
+    mov rdi, 100001
+#----- Store a value to the memory address.
+    mov [rbp-484], edi
+    .loc 1 127 5
+#----- "If" statement
+    cmp dword ptr [rbp-484], 0
+    jne .L.end.97
+    .loc 1 128 16
+#----- Returns to the caller address.
+    mov rax, 0
+    jmp .L.inline.end.96
+.L.end.97:
+#----- Function call with up to 6 parameters. 
+    .loc 1 129 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-484]
+    push rax
+    .loc 1 129 24
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+#-- 引数をレジスタにセット 
+    mov rdi, rax
+    xor eax, eax
+    call is_even
+#----- Returns to the caller address.
+.L.inline.end.96:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-476], edi
+    .loc 1 204 31
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.27
+#----- Store a value to the memory address.
+    mov [rbp-472], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-480]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-476]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.98
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-472]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-476]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.98
+.L.else.98:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-472]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-480]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-476]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.98:
+.L.inline.end.95:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 205 12
+#----- Expression statement
+    mov rdi, 600
+#----- Store a value to the memory address.
+    mov [rbp-464], edi
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 205 30
+#-- 引数をレジスタにセット 
+    mov rdi, 200
+    xor eax, eax
+    call tail_in_expr
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-460], edi
+    .loc 1 205 36
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.28
+#----- Store a value to the memory address.
+    mov [rbp-456], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-464]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-460]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.100
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-456]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-460]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.100
+.L.else.100:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-456]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-464]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-460]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.100:
+.L.inline.end.99:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 206 12
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-448], edi
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 206 28
+#-- 引数をレジスタにセット 
+    mov rdi, 3
+    xor eax, eax
+    call tail_in_expr
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-444], edi
+    .loc 1 206 32
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.29
+#----- Store a value to the memory address.
+    mov [rbp-440], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-448]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-444]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.102
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-440]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-444]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.102
+.L.else.102:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-440]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-448]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-444]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.102:
+.L.inline.end.101:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 208 12
+#----- Expression statement
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-424], edi
+#----- Expression statement
+#----- Inlined call to abs_int
+#----- Expression statement
+    .loc 1 208 23
+    push 0
+    .loc 1 208 25
+    mov rdi, 5
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-428], edi
+    .loc 1 103 5
+#----- "If" statement
+    cmp dword ptr [rbp-428], 0
+    jge .L.end.105
+    .loc 1 104 16
+    push 0
+    .loc 1 104 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-428]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+#----- Returns to the caller address.
+    jmp .L.inline.end.104
+.L.end.105:
+    .loc 1 105 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-428]
+#----- Returns to the caller address.
+.L.inline.end.104:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-420], edi
+    .loc 1 208 29
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.30
+#----- Store a value to the memory address.
+    mov [rbp-416], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-424]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-420]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.106
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-416]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-420]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.106
+.L.else.106:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-416]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-424]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-420]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.106:
+.L.inline.end.103:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 209 12
+#----- Expression statement
+    mov rdi, 12
+#----- Store a value to the memory address.
+    mov [rbp-400], edi
+#----- Expression statement
+    .loc 1 209 16
+    push 1
+    .loc 1 209 21
+    push 2
+#----- Inlined call to max2
+    .loc 1 209 30
+#----- Expression statement
+    mov rdi, 9
+#----- Store a value to the memory address.
+    mov [rbp-408], edi
+#----- Expression statement
+#----- Inlined call to ret3
+    .loc 1 27 12
+#----- Returns to the caller address.
+    mov rax, 3
+.L.inline.end.109:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-404], edi
+#----- "If" statement
+    .loc 1 109 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-408]
+    push rax
+    .loc 1 109 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-404]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jge .L.end.110
+    .loc 1 110 16
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-404]
+#----- Returns to the caller address.
+    jmp .L.inline.end.108
+.L.end.110:
+    .loc 1 111 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-408]
+#----- Returns to the caller address.
+.L.inline.end.108:
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-396], edi
+    .loc 1 209 43
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.31
+#----- Store a value to the memory address.
+    mov [rbp-392], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-400]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-396]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.111
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-392]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-396]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.111
+.L.else.111:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-392]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-400]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-396]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.111:
+.L.inline.end.107:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 210 12
+#----- Expression statement
+    mov rdi, 10
+#----- Store a value to the memory address.
+    mov [rbp-376], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 210 32
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4448], edi
+#----- "For" statement
+#----- Expression statement
+    .loc 1 210 41
+    push 0
+    .loc 1 210 43
+    mov rdi, 4
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4452], edi
+    cmp dword ptr [rbp-4452], 0
+    jge .L.end.113
+    .p2align 4,,10
+.L.begin.113:
+#----- Expression statement
+    .loc 1 210 60
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4448]
+    push rax
+#----- Inlined call to abs_int
+    .loc 1 210 70
+#----- Expression statement
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4452]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-380], edi
+    .loc 1 103 5
+#----- "If" statement
+    cmp dword ptr [rbp-380], 0
+    jge .L.end.115
+    .loc 1 104 16
+    push 0
+    .loc 1 104 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-380]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+#----- Returns to the caller address.
+    jmp .L.inline.end.114
+.L.end.115:
+    .loc 1 105 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-380]
+#----- Returns to the caller address.
+.L.inline.end.114:
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-4448], edi
+#----- Expression statement
+    .loc 1 210 52
+#----- Read-modify-write
+    add dword ptr [rbp-4452], 1
+    movsxd rax, dword ptr [rbp-4452]
+    cmp dword ptr [rbp-4452], 0
+    jl .L.begin.113
+.L.end.113:
+    .loc 1 210 74
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4448]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-372], edi
+    .loc 1 210 81
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.32
+#----- Store a value to the memory address.
+    mov [rbp-368], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-376]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-372]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.116
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-368]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-372]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.116
+.L.else.116:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-368]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-376]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-372]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.116:
+.L.inline.end.112:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 212 12
+#----- Expression statement
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-352], edi
+#----- Expression statement
+#----- Inlined call to early_ret
+    .loc 1 212 25
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-360], edi
+#----- Expression statement
+    .loc 1 98 13
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-356], edi
+    .loc 1 99 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-356]
+    push rax
+#----- Block {...} or Statement expression
+#----- "If" statement
+    .loc 1 99 23
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-360]
+    test rax, rax
+    je .L.end.119
+    .loc 1 99 33
+#----- Returns to the caller address.
+    mov rax, 5
+    add rsp, 8
+    jmp .L.inline.end.118
+.L.end.119:
+    .loc 1 99 36
+    mov rdi, 3
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+.L.inline.end.118:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-348], edi
+    .loc 1 212 29
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.33
+#----- Store a value to the memory address.
+    mov [rbp-344], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-352]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-348]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.120
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-344]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-348]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.120
+.L.else.120:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-344]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-352]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-348]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.120:
+.L.inline.end.117:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 213 12
+#----- Expression statement
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-328], edi
+#----- Expression statement
+#----- Inlined call to dead_inline_store
+#----- Expression statement
+#----- Inlined call to pick
+    .loc 1 168 14
+#----- Expression statement
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-332], edi
+#----- "If" statement
+    .loc 1 160 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-332]
+    test rax, rax
+    je .L.end.124
+    .loc 1 161 16
+#----- Returns to the caller address.
+    mov rax, 1
+    jmp .L.inline.end.123
+.L.end.124:
+    .loc 1 162 12
+#----- Returns to the caller address.
+    mov rax, 2
+.L.inline.end.123:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-336], edi
+    .loc 1 169 12
+#----- Returns to the caller address.
+    mov rax, 4
+.L.inline.end.122:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-324], edi
+    .loc 1 213 36
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.34
+#----- Store a value to the memory address.
+    mov [rbp-320], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-328]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-324]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.125
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-320]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-324]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.125
+.L.else.125:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-320]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-328]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-324]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.125:
+.L.inline.end.121:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 214 12
+#----- Expression statement
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-304], edi
+#----- Expression statement
+#----- Inlined call to tail_in_cond
+    .loc 1 214 28
+#----- Expression statement
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-308], edi
+#----- "If" statement
+#----- Block {...} or Statement expression
+    .loc 1 139 11
+#----- "If" statement
+    cmp dword ptr [rbp-308], 0
+    jle .L.end.129
+#----- Function call with up to 6 parameters. 
+    .loc 1 139 41
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-308]
+    push rax
+    .loc 1 139 45
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+#-- 引数をレジスタにセット 
+    mov rdi, rax
+    xor eax, eax
+    call tail_in_cond
+#----- Returns to the caller address.
+    jmp .L.inline.end.127
+.L.end.129:
+    .loc 1 139 49
+    xor eax, eax
+    test rax, rax
+    je .L.end.128
+    .loc 1 140 16
+#----- Returns to the caller address.
+    mov rax, 7
+    jmp .L.inline.end.127
+.L.end.128:
+    .loc 1 141 12
+#----- Returns to the caller address.
+    mov rax, 3
+.L.inline.end.127:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-300], edi
+    .loc 1 214 32
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.35
+#----- Store a value to the memory address.
+    mov [rbp-296], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-304]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-300]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.130
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-296]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-300]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.130
+.L.else.130:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-296]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-304]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-300]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.130:
+.L.inline.end.126:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 215 12
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-288], edi
+#----- Expression statement
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 215 30
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-4441], dil
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 215 41
+    mov rdi, 1000
+    add [rbp-4441], dil
+    movsx rax, byte ptr [rbp-4441]
+    .loc 1 215 47
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-4441]
+    push rax
+    .loc 1 215 52
+    push 0
+    .loc 1 215 54
+    mov rdi, 24
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-284], edi
+    .loc 1 215 62
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.36
+#----- Store a value to the memory address.
+    mov [rbp-280], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-288]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-284]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.132
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-280]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-284]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.132
+.L.else.132:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-280]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-288]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-284]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.132:
+.L.inline.end.131:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 216 12
+#----- Expression statement
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-256], edi
+#----- Expression statement
+#----- Inlined call to kept_and
+    .loc 1 216 24
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-268], edi
+    .loc 1 216 27
+#----- Expression statement
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-264], edi
+#----- Expression statement
+    .loc 1 149 10
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-268]
+    test rax, rax
+    je .L.false.135
+    .loc 1 149 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-264]
+    test rax, rax
+    je .L.false.135
+    push 1
+    jmp .L.end.135
+.L.false.135:
+    push 0
+.L.end.135:
+    .loc 1 149 20
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call unwind_ok
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-260], edi
+    .loc 1 150 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-260]
+#----- Returns to the caller address.
+.L.inline.end.134:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-252], edi
+    .loc 1 216 31
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.37
+#----- Store a value to the memory address.
+    mov [rbp-248], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-256]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-252]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.136
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-248]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-252]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.136
+.L.else.136:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-248]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-256]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-252]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.136:
+.L.inline.end.133:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 217 12
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-224], edi
+#----- Expression statement
+#----- Inlined call to kept_and
+    .loc 1 217 24
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-236], edi
+    .loc 1 217 27
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-232], edi
+#----- Expression statement
+    .loc 1 149 10
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-236]
+    test rax, rax
+    je .L.false.139
+    .loc 1 149 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-232]
+    test rax, rax
+    je .L.false.139
+    push 1
+    jmp .L.end.139
+.L.false.139:
+    push 0
+.L.end.139:
+    .loc 1 149 20
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call unwind_ok
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-228], edi
+    .loc 1 150 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-228]
+#----- Returns to the caller address.
+.L.inline.end.138:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-220], edi
+    .loc 1 217 31
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.38
+#----- Store a value to the memory address.
+    mov [rbp-216], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-224]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-220]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.140
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-216]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-220]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.140
+.L.else.140:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-216]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-224]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-220]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.140:
+.L.inline.end.137:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 218 12
+#----- Expression statement
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-192], edi
+#----- Expression statement
+#----- Inlined call to kept_or
+    .loc 1 218 23
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-204], edi
+    .loc 1 218 26
+#----- Expression statement
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-200], edi
+#----- Expression statement
+    .loc 1 155 10
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-204]
+    test rax, rax
+    jne .L.skip.144
+    .loc 1 155 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-200]
+    test rax, rax
+    je .L.false.143
+.L.skip.144:
+    push 1
+    jmp .L.end.143
+.L.false.143:
+    push 0
+.L.end.143:
+    .loc 1 155 20
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call unwind_ok
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-196], edi
+    .loc 1 156 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-196]
+#----- Returns to the caller address.
+.L.inline.end.142:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-188], edi
+    .loc 1 218 30
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.39
+#----- Store a value to the memory address.
+    mov [rbp-184], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-192]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-188]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.145
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-184]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-188]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.145
+.L.else.145:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-184]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-192]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-188]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.145:
+.L.inline.end.141:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 219 12
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-160], edi
+#----- Expression statement
+#----- Inlined call to kept_or
+    .loc 1 219 23
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-172], edi
+    .loc 1 219 26
+#----- Expression statement
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-168], edi
+#----- Expression statement
+    .loc 1 155 10
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-172]
+    test rax, rax
+    jne .L.skip.149
+    .loc 1 155 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-168]
+    test rax, rax
+    je .L.false.148
+.L.skip.149:
+    push 1
+    jmp .L.end.148
+.L.false.148:
+    push 0
+.L.end.148:
+    .loc 1 155 20
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call unwind_ok
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-164], edi
+    .loc 1 156 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-164]
+#----- Returns to the caller address.
+.L.inline.end.147:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-156], edi
+    .loc 1 219 30
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.40
+#----- Store a value to the memory address.
+    mov [rbp-152], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-160]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-156]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.150
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-152]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-156]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.150
+.L.else.150:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-152]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-160]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-156]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.150:
+.L.inline.end.146:
+#----- Expression statement
+#----- Inlined call to assert
+    .loc 1 220 12
+#----- Expression statement
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-128], edi
+#----- Expression statement
+#----- Inlined call to early_ret
+    .loc 1 220 25
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-144], edi
+#----- Expression statement
+    .loc 1 98 13
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-140], edi
+    .loc 1 99 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-140]
+    push rax
+#----- Block {...} or Statement expression
+#----- "If" statement
+    .loc 1 99 23
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-144]
+    test rax, rax
+    je .L.end.153
+    .loc 1 99 33
+#----- Returns to the caller address.
+    mov rax, 5
+    add rsp, 8
+    jmp .L.inline.end.152
+.L.end.153:
+    .loc 1 99 36
+    mov rdi, 3
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+.L.inline.end.152:
+    push rax
+#----- Inlined call to early_ret
+    .loc 1 220 40
+#----- Expression statement
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-136], edi
+#----- Expression statement
+    .loc 1 98 13
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-132], edi
+    .loc 1 99 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-132]
+    push rax
+#----- Block {...} or Statement expression
+#----- "If" statement
+    .loc 1 99 23
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-136]
+    test rax, rax
+    je .L.end.155
+    .loc 1 99 33
+#----- Returns to the caller address.
+    mov rax, 5
+    add rsp, 8
+    jmp .L.inline.end.154
+.L.end.155:
+    .loc 1 99 36
+    mov rdi, 3
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+.L.inline.end.154:
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 220 45
+    mov rdi, 5
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-124], edi
+    .loc 1 220 48
+#----- Expression statement
+#----- Global variable
+    mov rdi, offset .L.data.41
+#----- Store a value to the memory address.
+    mov [rbp-120], rdi
+#----- "If" statement
+    .loc 1 17 8
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-128]
+    push rax
+    .loc 1 17 20
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-124]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.else.156
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 18 16
+#----- Global variable
+    push offset .L.data.0
+    .loc 1 18 30
+#----- Load a value from the memory address.
+    mov rax, [rbp-120]
+    push rax
+    .loc 1 18 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-124]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+    jmp .L.end.156
+.L.else.156:
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 20 16
+#----- Global variable
+    push offset .L.data.1
+    .loc 1 20 50
+#----- Load a value from the memory address.
+    mov rax, [rbp-120]
+    push rax
+    .loc 1 20 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-128]
+    push rax
+    .loc 1 20 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-124]
+#-- 引数をレジスタにセット 
+    mov rcx, rax
+    pop rdx
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call printf
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 21 14
+#-- 引数をレジスタにセット 
+    mov rdi, 1
+    xor eax, eax
+    call exit
+.L.end.156:
+.L.inline.end.151:
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 222 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 222 27
+#----- Global variable
+    mov rdi, offset g2
+#----- Store a value to the memory address.
+    mov [rbp-4440], rdi
+    .loc 1 222 31
+#----- Load a value from the memory address.
+    mov rax, [rbp-4440]
+    push rax
+    .loc 1 222 35
+#----- Load a value from the memory address.
+    mov rax, [rbp-4440]
+    push rax
+    .loc 1 222 37
+    mov rdi, 16
+    pop rax
+    cqo
+    idiv rax, rdi
+    push rax
+    .loc 1 222 40
+    mov rdi, 16
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 222 48
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.42
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 223 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 223 27
+#----- Global variable
+    mov rdi, offset g1
+#----- Store a value to the memory address.
+    mov [rbp-4432], rdi
+    .loc 1 223 32
+#----- Load a value from the memory address.
+    mov rax, [rbp-4432]
+    push rax
+    .loc 1 223 36
+#----- Load a value from the memory address.
+    mov rax, [rbp-4432]
+    push rax
+    .loc 1 223 38
+    mov rdi, 4
+    pop rax
+    cqo
+    idiv rax, rdi
+    push rax
+    .loc 1 223 40
+    mov rdi, 4
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 223 47
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.43
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 225 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 225 28
+#----- Global variable
+    mov rdi, offset .L.data.44
+#----- Store a value to the memory address.
+    mov [rbp-4424], rdi
+#----- Expression statement
+    .loc 1 225 46
+#----- Global variable
+    mov rdi, offset .L.data.44
+#----- Store a value to the memory address.
+    mov [rbp-4416], rdi
+    .loc 1 225 54
+#----- Load a value from the memory address.
+    mov rax, [rbp-4424]
+    push rax
+    .loc 1 225 59
+#----- Load a value from the memory address.
+    mov rax, [rbp-4416]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 225 66
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.45
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 226 12
+    push 111
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 226 30
+#----- Global variable
+    mov rdi, offset .L.data.46
+#----- Store a value to the memory address.
+    mov [rbp-4408], rdi
+#----- Expression statement
+    .loc 1 226 57
+#----- Global variable
+    mov rdi, offset .L.data.44
+#----- Store a value to the memory address.
+    mov [rbp-4400], rdi
+#----- Load a value from the memory address.
+    .loc 1 226 65
+#----- Load a value from the memory address.
+    mov rax, [rbp-4400]
+    movsx rax, byte ptr [rax+1]
+    push rax
+    .loc 1 226 75
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.47
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 227 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 227 28
+#----- Global variable
+    mov rdi, offset .L.data.48
+#----- Store a value to the memory address.
+    mov [rbp-4392], rdi
+#----- Load a value from the memory address.
+    .loc 1 227 35
+#----- Load a value from the memory address.
+    mov rax, [rbp-4392]
+    movsx rax, byte ptr [rax+3]
+    push rax
+    .loc 1 227 45
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.49
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 228 12
+    push 98
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 228 29
+#----- Global variable
+    mov rdi, offset .L.data.50
+#----- Store a value to the memory address.
+    mov [rbp-4384], rdi
+#----- Load a value from the memory address.
+    .loc 1 228 37
+#----- Load a value from the memory address.
+    mov rax, [rbp-4384]
+    movsx rax, byte ptr [rax+2]
+    push rax
+    .loc 1 228 47
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.51
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 230 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 230 64
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-4358], dil
+#----- Expression statement
+    .loc 1 230 69
+    lea rax, [rbp-4370]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-4357]
+    mov rsi, [rdi+0]
+    mov [rax+0], rsi
+    mov esi, [rdi+8]
+    mov [rax+8], esi
+    mov sil, [rdi+12]
+    mov [rax+12], sil
+    .loc 1 230 75
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-4345]
+    push rax
+    .loc 1 230 85
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.52
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 231 12
+    push 12
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 231 67
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-4344], rdi
+#----- Expression statement
+    .loc 1 231 77
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-4320], edi
+#----- Expression statement
+    .loc 1 231 82
+    lea rax, [rbp-4344]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-4312]
+    movdqu xmm0, [rdi+0]
+    movdqu [rax+0], xmm0
+    movdqu xmm0, [rdi+16]
+    movdqu [rax+16], xmm0
+    .loc 1 231 87
+#----- Load a value from the memory address.
+    mov rax, [rbp-4312]
+    push rax
+    .loc 1 231 92
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-4288]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 231 101
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.53
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 232 12
+    push 12
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 232 74
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-3980], dil
+#----- Expression statement
+    .loc 1 232 81
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-3976], edi
+#----- Expression statement
+    .loc 1 232 86
+    lea rax, [rbp-4280]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-3972]
+    mov rdx, rdi
+    mov rsi, rdi
+    mov rdi, rax
+    mov rcx, 308
+    rep movsb
+    mov rdi, rdx
+    .loc 1 232 92
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-3672]
+    push rax
+    .loc 1 232 100
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3668]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 232 107
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.54
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 233 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 233 67
+    lea rax, [rbp-3504]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3344], rdi
+#----- Expression statement
+    .loc 1 233 79
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3508], edi
+#----- Expression statement
+    .loc 1 233 83
+#----- Load a value from the memory address.
+    mov rax, [rbp-3344]
+    push rax
+    .loc 1 233 85
+    lea rax, [rbp-3664]
+    mov rdi, rax
+    pop rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    mov rdx, rdi
+    mov rsi, rdi
+    mov rdi, rax
+    mov rcx, 160
+    rep movsb
+    mov rdi, rdx
+    .loc 1 233 91
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3348]
+    push rax
+    .loc 1 233 101
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.55
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 235 12
+    push 13
+    .loc 1 235 16
+    push 2
+#----- Block {...} or Statement expression
+    .loc 1 235 23
+    push 1
+#----- Inlined call to add2
+#----- Expression statement
+#----- Inlined call to ret5
+    .loc 1 32 12
+#----- Returns to the caller address.
+    mov rax, 5
+.L.inline.end.158:
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-112], edi
+    .loc 1 235 40
+#----- Expression statement
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-108], edi
+    .loc 1 36 12
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-112]
+    push rax
+    .loc 1 36 14
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-108]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+#----- Returns to the caller address.
+.L.inline.end.157:
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 235 48
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.56
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 236 12
+    push 21
+    .loc 1 236 16
+    push 1
+    .loc 1 236 21
+    push 2
+#----- Function call with up to 6 parameters. 
+    .loc 1 236 30
+    push 1
+    .loc 1 236 33
+    push 2
+    .loc 1 236 36
+    push 3
+    .loc 1 236 39
+    push 4
+    .loc 1 236 42
+    push 5
+    .loc 1 236 45
+#-- 引数をレジスタにセット 
+    mov r9, 6
+    pop r8
+    pop rcx
+    pop rdx
+    pop rsi
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call add6
+    add rsp, 8
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 236 50
+    mov rdi, 3
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 236 54
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.57
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 238 12
+    push 1
+    .loc 1 238 17
+    push 1
+    jmp .L.end.159
+.L.false.159:
+    push 0
+.L.end.159:
+    .loc 1 238 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.58
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 239 12
+    push 0
+    .loc 1 239 17
+    jmp .L.false.160
+    push 1
+    jmp .L.end.160
+.L.false.160:
+    push 0
+.L.end.160:
+    .loc 1 239 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.59
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 240 12
+    push 0
+    .loc 1 240 17
+    jmp .L.false.161
+    push 1
+    jmp .L.end.161
+.L.false.161:
+    push 0
+.L.end.161:
+    .loc 1 240 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.60
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 241 12
+    push 1
+    .loc 1 241 17
+.L.skip.163:
+    push 1
+    jmp .L.end.162
+.L.false.162:
+    push 0
+.L.end.162:
+    .loc 1 241 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.61
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 242 12
+    push 0
+    .loc 1 242 17
+    jmp .L.false.164
+.L.skip.165:
+    push 1
+    jmp .L.end.164
+.L.false.164:
+    push 0
+.L.end.164:
+    .loc 1 242 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.62
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 243 12
+    push 1
+    .loc 1 243 16
+    xor eax, eax
+    test rax, rax
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 243 19
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.63
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 244 12
+    push 0
+    .loc 1 244 16
+    mov rax, 5
+    test rax, rax
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 244 19
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.64
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 245 12
+    push 1
+    .loc 1 245 25
+    jmp .L.skip.167
+    jmp .L.false.166
+.L.skip.167:
+    push 1
+    jmp .L.end.166
+.L.false.166:
+    push 0
+.L.end.166:
+    .loc 1 245 31
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.65
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 246 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 246 24
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3332], edi
+#----- Expression statement
+    .loc 1 246 29
+    jmp .L.false.168
+    .loc 1 246 35
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-3332], edi
+    mov rax, rdi
+    test rax, rax
+    je .L.false.168
+    push 1
+    jmp .L.end.168
+.L.false.168:
+    push 0
+.L.end.168:
+    add rsp, 8
+    .loc 1 246 39
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3332]
+    push rax
+    .loc 1 246 46
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.66
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 247 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 247 24
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3328], edi
+#----- Expression statement
+    .loc 1 247 29
+    jmp .L.skip.170
+    .loc 1 247 35
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-3328], edi
+    mov rax, rdi
+    test rax, rax
+    je .L.false.169
+.L.skip.170:
+    push 1
+    jmp .L.end.169
+.L.false.169:
+    push 0
+.L.end.169:
+    add rsp, 8
+    .loc 1 247 39
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3328]
+    push rax
+    .loc 1 247 46
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.67
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 248 12
+    push 4
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 248 33
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-3324], edi
+#----- Expression statement
+    .loc 1 248 41
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-3320], edi
+#----- Expression statement
+    .loc 1 248 49
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-3316], edi
+#----- Expression statement
+    .loc 1 248 57
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3312], edi
+#----- Expression statement
+    .loc 1 248 66
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-3308], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 248 82
+    lea rax, [rbp-3324]
+    push rax
+    .loc 1 248 84
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3308]
+    mov rdi, rax
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-40], rdi
+    .loc 1 248 69
+#----- "While" statement
+    cmp dword ptr [rbp-3308], 4
+    jge .L.end.171
+    .loc 1 248 83
+#----- Load a value from the memory address.
+#----- Load a value from the memory address.
+    mov rax, [rbp-40]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 248 88
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3308]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jne .L.end.171
+    .p2align 4,,10
+.L.begin.171:
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 248 92
+#----- Read-modify-write
+    add dword ptr [rbp-3308], 1
+    movsxd rax, dword ptr [rbp-3308]
+    .loc 1 248 91
+#----- Expression statement
+#----- Read-modify-write
+    add qword ptr [rbp-40], 4
+    mov rax, [rbp-40]
+    cmp dword ptr [rbp-3308], 4
+    jge .L.skip.172
+    .loc 1 248 83
+#----- Load a value from the memory address.
+#----- Load a value from the memory address.
+    mov rax, [rbp-40]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 248 88
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3308]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    je .L.begin.171
+.L.skip.172:
+.L.end.171:
+    .loc 1 248 98
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3308]
+    push rax
+    .loc 1 248 105
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.68
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 249 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 249 24
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-3304], edi
+#----- Expression statement
+    .loc 1 249 33
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-3300], edi
+    .loc 1 249 36
+#----- "For" statement
+    cmp dword ptr [rbp-3304], 5
+    jge .L.end.173
+    cmp dword ptr [rbp-3300], 2
+    je .L.end.173
+    .p2align 4,,10
+.L.begin.173:
+#----- Expression statement
+    .loc 1 249 67
+#----- Read-modify-write
+    add dword ptr [rbp-3300], 1
+    movsxd rax, dword ptr [rbp-3300]
+#----- Expression statement
+    .loc 1 249 60
+#----- Read-modify-write
+    add dword ptr [rbp-3304], 1
+    movsxd rax, dword ptr [rbp-3304]
+    cmp dword ptr [rbp-3304], 5
+    jge .L.skip.174
+    cmp dword ptr [rbp-3300], 2
+    jne .L.begin.173
+.L.skip.174:
+.L.end.173:
+    .loc 1 249 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3300]
+    push rax
+    .loc 1 249 80
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.69
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 250 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 250 24
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-3296], edi
+    .loc 1 250 27
+#----- "If" statement
+    cmp dword ptr [rbp-3296], 0
+    jle .L.end.175
+    cmp dword ptr [rbp-3296], 5
+    jg .L.end.175
+#----- Expression statement
+    .loc 1 250 51
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-3296], edi
+.L.end.175:
+    .loc 1 250 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3296]
+    push rax
+    .loc 1 250 61
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.70
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 252 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 252 34
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-3276], edi
+#----- Expression statement
+    .loc 1 252 39
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3276]
+    push rax
+    .loc 1 252 46
+    mov rdi, 5
+    pop rdx
+#----- Store a value to the memory address.
+    mov [rbp+rdx*4-3288], edi
+    .loc 1 252 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3284]
+    push rax
+    .loc 1 252 59
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.71
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 253 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 253 24
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3272], edi
+#----- Expression statement
+    .loc 1 253 29
+#----- Read-modify-write
+    add dword ptr [rbp-3272], 4
+    movsxd rax, dword ptr [rbp-3272]
+    .loc 1 253 38
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3272]
+    push rax
+    .loc 1 253 45
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.72
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 254 12
+    push 0
+    .loc 1 254 13
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    push rax
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 254 35
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-3266], dil
+#----- Expression statement
+    .loc 1 254 43
+#----- Read-modify-write
+    sub byte ptr [rbp-3266], 2
+    movsx rax, byte ptr [rbp-3266]
+    .loc 1 254 56
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-3266]
+    push rax
+    .loc 1 254 65
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.73
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 255 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 255 35
+    lea rax, [rbp-3264]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3248], rdi
+#----- Expression statement
+    .loc 1 255 43
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3256], edi
+#----- Expression statement
+    .loc 1 255 48
+#----- Read-modify-write
+    add qword ptr [rbp-3248], 4
+    mov rax, [rbp-3248]
+#----- Load a value from the memory address.
+    .loc 1 255 57
+#----- Load a value from the memory address.
+    mov rax, [rbp-3248]
+    movsxd rax, dword ptr [rax+4]
+    push rax
+    .loc 1 255 67
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.74
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 256 12
+    push 4
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 256 56
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-3204], edi
+#----- Expression statement
+    .loc 1 256 59
+    lea rax, [rbp-3236]
+    push rax
+    .loc 1 256 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3204]
+    mov rdi, rax
+    pop rax
+    imul rdi, 16
+    add rax, rdi
+    push rax
+    .loc 1 256 69
+    mov rdi, 4
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+12], edi
+#----- Load a value from the memory address.
+    .loc 1 256 79
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3204]
+    mov rdx, rax
+    movsxd rax, dword ptr [rbp+rdx*4-3212]
+    push rax
+    .loc 1 256 89
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.75
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+    .loc 1 257 13
+    mov rdi, 9
+#----- Store a value to the memory address.
+    mov [rip+g2+12], edi
+#----- Expression statement
+    .loc 1 257 22
+#----- Read-modify-write
+    sub dword ptr [rip+g2+12], 1
+    movsxd rax, dword ptr [rip+g2+12]
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 258 12
+    push 8
+    .loc 1 258 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rip+g2+12]
+    push rax
+    .loc 1 258 22
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.76
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 259 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 259 43
+    lea rax, [rbp-3172]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3192], rdi
+#----- Expression statement
+    .loc 1 259 49
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3172], edi
+#----- Load a value from the memory address.
+    .loc 1 259 54
+#----- Load a value from the memory address.
+    mov rax, [rbp-3192]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 259 63
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.77
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 260 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 260 43
+    lea rax, [rbp-3144]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3160], rdi
+#----- Expression statement
+    .loc 1 260 49
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-3144], edi
+#----- Load a value from the memory address.
+    .loc 1 260 53
+#----- Load a value from the memory address.
+    mov rax, [rbp-3160]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 260 65
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.78
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 261 12
+    push 12
+#----- Block {...} or Statement expression
+    .loc 1 261 40
+    lea rax, [rbp-3128]
+    push rax
+    .loc 1 261 45
+    lea rax, [rbp-3140]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    cqo
+    mov rdi, 1
+    idiv rdi
+    push rax
+    .loc 1 261 53
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.79
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 262 12
+    push 1
+#----- Block {...} or Statement expression
+    .loc 1 262 39
+    lea rax, [rbp-3120]
+    push rax
+    .loc 1 262 44
+    lea rax, [rbp-3124]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    cqo
+    mov rdi, 4
+    idiv rdi
+    push rax
+    .loc 1 262 52
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.80
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 263 12
+    push 1
+#----- Block {...} or Statement expression
+    .loc 1 263 39
+    lea rax, [rbp-3104]
+    push rax
+    .loc 1 263 44
+    lea rax, [rbp-3108]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    cqo
+    mov rdi, 4
+    idiv rdi
+    push rax
+    .loc 1 263 52
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.81
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 264 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 264 41
+    lea rax, [rbp-3096]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3088], edi
+#----- Expression statement
+    .loc 1 264 53
+    lea rax, [rbp-3089]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3084], edi
+    .loc 1 264 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3084]
+    push rax
+    .loc 1 264 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3088]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 264 68
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.82
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 265 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 265 44
+    lea rax, [rbp-3079]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3072], edi
+#----- Expression statement
+    .loc 1 265 56
+    lea rax, [rbp-3076]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3068], edi
+    .loc 1 265 60
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3068]
+    push rax
+    .loc 1 265 64
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3072]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 265 71
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.83
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 266 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 266 41
+    lea rax, [rbp-3061]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3056], edi
+#----- Expression statement
+    .loc 1 266 53
+    lea rax, [rbp-3060]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-3052], edi
+    .loc 1 266 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3052]
+    push rax
+    .loc 1 266 61
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-3056]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 266 68
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.84
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 270 12
+    push 0
+    .loc 1 270 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rip+g1]
+    push rax
+    .loc 1 270 19
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.85
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+    .loc 1 271 8
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rip+g1], edi
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 272 12
+    push 3
+#----- Load a value from the memory address.
+#----- Inlined call to g1_ptr
+    .loc 1 68 12
+#----- Global variable
+#----- Returns to the caller address.
+    mov rax, offset g1
+.L.inline.end.176:
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 272 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.86
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 274 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 274 34
+    push 8
+    .loc 1 274 49
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.87
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 275 12
+    push 96
+#----- Block {...} or Statement expression
+    .loc 1 275 33
+    push 96
+    .loc 1 275 48
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.88
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 276 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 276 31
+    push 8
+    .loc 1 276 46
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.89
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 277 12
+    push 24
+#----- Block {...} or Statement expression
+    .loc 1 277 30
+    push 24
+    .loc 1 277 45
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.90
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 278 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 278 43
+    lea rax, [rbp-2880]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2904], rdi
+#----- Expression statement
+    .loc 1 278 49
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2880], edi
+#----- Load a value from the memory address.
+    .loc 1 278 53
+#----- Load a value from the memory address.
+    mov rax, [rbp-2904]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 278 65
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.91
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 279 12
+    push 4
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 279 40
+    lea rax, [rbp-2876]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2864], rdi
+#----- Expression statement
+    .loc 1 279 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-2864]
+    push rax
+    .loc 1 279 51
+    mov rdi, 4
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+#----- Load a value from the memory address.
+    .loc 1 279 54
+#----- Load a value from the memory address.
+    mov rax, [rbp-2864]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 279 67
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.92
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 282 12
+    push 2
+#----- Block {...} or Statement expression
+    .loc 1 282 27
+    push 2
+    .loc 1 282 42
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.93
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 283 12
+    push 4
+#----- Block {...} or Statement expression
+    .loc 1 283 49
+    push 4
+    .loc 1 283 64
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.94
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 285 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 285 26
+    push 8
+    .loc 1 285 41
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.95
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 286 12
+    push 16
+#----- Block {...} or Statement expression
+    .loc 1 286 49
+    push 16
+    .loc 1 286 64
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.94
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 288 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 288 28
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-2822], di
+#----- Expression statement
+    .loc 1 288 41
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2820], di
+#----- Expression statement
+    .loc 1 288 54
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2818], di
+#----- Inlined call to sub_short
+    .loc 1 288 67
+#----- Expression statement
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-2822]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-102], di
+    .loc 1 288 70
+#----- Expression statement
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-2820]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-100], di
+    .loc 1 288 73
+#----- Expression statement
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-2818]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-98], di
+    .loc 1 60 12
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-102]
+    push rax
+    .loc 1 60 16
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-100]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 60 20
+#----- Load a value from the memory address.
+    movsx rax, word ptr [rbp-98]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+#----- Returns to the caller address.
+.L.inline.end.177:
+    push rax
+    .loc 1 288 81
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.96
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 289 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 289 27
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-2816], rdi
+#----- Expression statement
+    .loc 1 289 39
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2808], rdi
+#----- Expression statement
+    .loc 1 289 51
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2800], rdi
+#----- Function call with up to 6 parameters. 
+    .loc 1 289 63
+#----- Load a value from the memory address.
+    mov rax, [rbp-2816]
+    push rax
+    .loc 1 289 66
+#----- Load a value from the memory address.
+    mov rax, [rbp-2808]
+    push rax
+    .loc 1 289 69
+#----- Load a value from the memory address.
+    mov rax, [rbp-2800]
+#-- 引数をレジスタにセット 
+    mov rdx, rax
+    pop rsi
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call sub_long
+    add rsp, 8
+    push rax
+    .loc 1 289 77
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.97
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 292 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 292 62
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2792], edi
+#----- Expression statement
+    .loc 1 292 67
+    lea rax, [rbp-2792]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-2784]
+    mov rsi, [rdi+0]
+    mov [rax+0], rsi
+    .loc 1 292 72
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2784]
+    push rax
+    .loc 1 292 79
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.98
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 293 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 293 62
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-2772], edi
+#----- Expression statement
+    .loc 1 293 67
+    lea rax, [rbp-2776]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-2768]
+    mov rsi, [rdi+0]
+    mov [rax+0], rsi
+    .loc 1 293 72
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2764]
+    push rax
+    .loc 1 293 79
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.99
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 294 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 294 60
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-2760], edi
+#----- Expression statement
+    .loc 1 294 87
+    lea rax, [rbp-2752]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2744], rdi
+#----- Expression statement
+    .loc 1 294 92
+#----- Load a value from the memory address.
+    mov rax, [rbp-2744]
+    push rax
+    .loc 1 294 94
+    lea rax, [rbp-2760]
+    mov rdi, rax
+    pop rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    mov rsi, [rdi+0]
+    mov [rax+0], rsi
+    .loc 1 294 99
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2752]
+    push rax
+    .loc 1 294 106
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.100
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 295 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 295 60
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-2736], edi
+#----- Expression statement
+    .loc 1 295 87
+    lea rax, [rbp-2736]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2720], rdi
+#----- Expression statement
+    .loc 1 295 103
+    lea rax, [rbp-2728]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2712], rdi
+#----- Expression statement
+    .loc 1 295 108
+#----- Load a value from the memory address.
+    mov rax, [rbp-2712]
+    push rax
+    .loc 1 295 111
+#----- Load a value from the memory address.
+    mov rax, [rbp-2720]
+    mov rdi, rax
+    pop rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    mov rsi, [rdi+0]
+    mov [rax+0], rsi
+    .loc 1 295 116
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2728]
+    push rax
+    .loc 1 295 123
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.101
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 296 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 296 64
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-2704], dil
+#----- Expression statement
+    .loc 1 296 69
+    lea rax, [rbp-2704]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-2702]
+    mov si, [rdi+0]
+    mov [rax+0], si
+    .loc 1 296 74
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2702]
+    push rax
+    .loc 1 296 81
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.102
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 297 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 297 63
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2696], dil
+#----- Expression statement
+    .loc 1 297 68
+    lea rax, [rbp-2700]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-2692]
+    mov rsi, [rdi+0]
+    mov [rax+0], rsi
+    .loc 1 297 73
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2688]
+    push rax
+    .loc 1 297 80
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.103
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 298 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 298 63
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2680], edi
+#----- Expression statement
+    .loc 1 298 68
+    lea rax, [rbp-2684]
+    mov rdi, rax
+#----- Store a value to the memory address.
+#----- TY_STRUCT
+    lea rax, [rbp-2676]
+    mov rsi, [rdi+0]
+    mov [rax+0], rsi
+    .loc 1 298 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2672]
+    push rax
+    .loc 1 298 80
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.103
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 300 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 300 47
+    push 8
+    .loc 1 300 62
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.104
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 301 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 301 53
+    mov rdi, 515
+#----- Store a value to the memory address.
+    mov [rbp-2660], edi
+    .loc 1 301 61
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2660]
+    push rax
+    .loc 1 301 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.105
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 302 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 302 53
+    mov rdi, 515
+#----- Store a value to the memory address.
+    mov [rbp-2656], edi
+    .loc 1 302 61
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2655]
+    push rax
+    .loc 1 302 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.106
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 303 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 303 53
+    mov rdi, 515
+#----- Store a value to the memory address.
+    mov [rbp-2652], edi
+    .loc 1 303 61
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2650]
+    push rax
+    .loc 1 303 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.106
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 304 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 304 53
+    mov rdi, 515
+#----- Store a value to the memory address.
+    mov [rbp-2648], edi
+    .loc 1 304 61
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2645]
+    push rax
+    .loc 1 304 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.106
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 306 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 306 54
+    lea rax, [rbp-2641]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2640], rdi
+#----- Expression statement
+    .loc 1 306 64
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2641], dil
+#----- Load a value from the memory address.
+    .loc 1 306 67
+#----- Load a value from the memory address.
+    mov rax, [rbp-2640]
+    movsx rax, byte ptr [rax]
+    push rax
+    .loc 1 306 77
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.107
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 307 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 307 54
+    lea rax, [rbp-2625]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2624], rdi
+#----- Expression statement
+    .loc 1 307 58
+#----- Load a value from the memory address.
+    mov rax, [rbp-2624]
+    push rax
+    .loc 1 307 63
+    mov rdi, 3
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], dil
+    .loc 1 307 68
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2625]
+    push rax
+    .loc 1 307 75
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.108
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 309 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 309 58
+    push 8
+    .loc 1 309 73
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.109
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 310 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 310 56
+    push 8
+    .loc 1 310 71
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.110
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 311 12
+    push 2
+#----- Block {...} or Statement expression
+    .loc 1 311 80
+    push 2
+    .loc 1 311 95
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.111
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 312 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 312 43
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2588], edi
+#----- Expression statement
+    .loc 1 312 62
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2584], edi
+    .loc 1 312 65
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2588]
+    push rax
+    .loc 1 312 71
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2584]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 312 78
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.112
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 314 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 314 40
+    lea rax, [rbp-2580]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2572], edi
+#----- Expression statement
+    .loc 1 314 52
+    lea rax, [rbp-2573]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2568], edi
+    .loc 1 314 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2568]
+    push rax
+    .loc 1 314 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2572]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 314 64
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.113
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 315 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 315 40
+    lea rax, [rbp-2561]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2556], edi
+#----- Expression statement
+    .loc 1 315 52
+    lea rax, [rbp-2560]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2552], edi
+    .loc 1 315 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2552]
+    push rax
+    .loc 1 315 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2556]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 315 64
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.114
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 317 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 317 36
+    lea rax, [rbp-2548]
+    push rax
+    .loc 1 317 38
+    mov rdi, 2
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2528], rdi
+    .loc 1 317 41
+#----- Load a value from the memory address.
+    mov rax, [rbp-2528]
+    push rax
+    .loc 1 317 43
+    lea rax, [rbp-2548]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    cqo
+    mov rdi, 4
+    idiv rdi
+    push rax
+    .loc 1 317 49
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.115
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 319 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 319 49
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2516], edi
+#----- Expression statement
+    .loc 1 319 58
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2512], edi
+    .loc 1 319 63
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2516]
+    push rax
+    .loc 1 319 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.116
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 320 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 320 49
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2508], edi
+#----- Expression statement
+    .loc 1 320 58
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2504], edi
+    .loc 1 320 63
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2504]
+    push rax
+    .loc 1 320 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.117
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 321 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 321 58
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2500], dil
+#----- Expression statement
+    .loc 1 321 67
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2496], edi
+#----- Expression statement
+    .loc 1 321 76
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2492], dil
+    .loc 1 321 81
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2500]
+    push rax
+    .loc 1 321 87
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.118
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 322 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 322 58
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2488], dil
+#----- Expression statement
+    .loc 1 322 67
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2484], edi
+#----- Expression statement
+    .loc 1 322 76
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2480], dil
+    .loc 1 322 81
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2484]
+    push rax
+    .loc 1 322 87
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.119
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 323 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 323 58
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2476], dil
+#----- Expression statement
+    .loc 1 323 67
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2472], edi
+#----- Expression statement
+    .loc 1 323 76
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2468], dil
+    .loc 1 323 81
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2468]
+    push rax
+    .loc 1 323 87
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.120
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 325 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 325 56
+    lea rax, [rbp-2462]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2456], rdi
+#----- Expression statement
+    .loc 1 325 59
+#----- Load a value from the memory address.
+    mov rax, [rbp-2456]
+    push rax
+    .loc 1 325 66
+    xor edi, edi
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], dil
+    .loc 1 325 74
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2462]
+    push rax
+    .loc 1 325 80
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.121
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 326 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 326 56
+    lea rax, [rbp-2446]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2440], rdi
+#----- Expression statement
+    .loc 1 326 59
+#----- Load a value from the memory address.
+    mov rax, [rbp-2440]
+    push rax
+    .loc 1 326 66
+    mov rdi, 1
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+1], dil
+    .loc 1 326 74
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2445]
+    push rax
+    .loc 1 326 80
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.122
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 327 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 327 56
+    lea rax, [rbp-2430]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2424], rdi
+#----- Expression statement
+    .loc 1 327 59
+#----- Load a value from the memory address.
+    mov rax, [rbp-2424]
+    push rax
+    .loc 1 327 66
+    mov rdi, 2
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+2], dil
+    .loc 1 327 74
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2428]
+    push rax
+    .loc 1 327 80
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.123
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 328 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 328 56
+    lea rax, [rbp-2414]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2408], rdi
+#----- Expression statement
+    .loc 1 328 59
+#----- Load a value from the memory address.
+    mov rax, [rbp-2408]
+    push rax
+    .loc 1 328 66
+    mov rdi, 3
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+3], dil
+    .loc 1 328 74
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2411]
+    push rax
+    .loc 1 328 80
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.124
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 330 12
+    push 6
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 330 61
+    lea rax, [rbp-2400]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2392], rdi
+#----- Expression statement
+    .loc 1 330 72
+    mov rdi, 6
+#----- Store a value to the memory address.
+    mov [rbp-2400], dil
+#----- Load a value from the memory address.
+    .loc 1 330 75
+#----- Load a value from the memory address.
+    mov rax, [rbp-2392]
+    movsx rax, byte ptr [rax]
+    push rax
+    .loc 1 330 84
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.125
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 331 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 331 61
+    lea rax, [rbp-2384]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-2376], rdi
+#----- Expression statement
+    .loc 1 331 72
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-2381], dil
+#----- Load a value from the memory address.
+    .loc 1 331 75
+#----- Load a value from the memory address.
+    mov rax, [rbp-2376]
+    movsx rax, byte ptr [rax+3]
+    push rax
+    .loc 1 331 84
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.126
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 333 12
+    push 6
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 333 55
+    mov rdi, 6
+#----- Store a value to the memory address.
+    mov [rbp-2361], dil
+    .loc 1 333 62
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2361]
+    push rax
+    .loc 1 333 69
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.127
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 335 12
+    push 4
+#----- Block {...} or Statement expression
+    .loc 1 335 36
+    push 4
+    .loc 1 335 50
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.128
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 336 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 336 43
+    push 8
+    .loc 1 336 57
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.129
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 337 12
+    push 12
+#----- Block {...} or Statement expression
+    .loc 1 337 40
+    push 12
+    .loc 1 337 54
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.130
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 338 12
+    push 16
+#----- Block {...} or Statement expression
+    .loc 1 338 40
+    push 16
+    .loc 1 338 54
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.131
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 339 12
+    push 24
+#----- Block {...} or Statement expression
+    .loc 1 339 43
+    push 24
+    .loc 1 339 57
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.132
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 340 12
+    push 2
+#----- Block {...} or Statement expression
+    .loc 1 340 45
+    push 2
+    .loc 1 340 59
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.133
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 342 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 342 44
+    push 8
+    .loc 1 342 58
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.134
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 343 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 343 44
+    push 8
+    .loc 1 343 58
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.134
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 345 12
+    push 3
+#----- Comma operator. 
+#----- Comma operator. 
+    .loc 1 345 20
+    push 3
+    .loc 1 345 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.135
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 346 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 346 23
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2276], edi
+#----- Expression statement
+    .loc 1 346 32
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2272], edi
+#----- Expression statement
+#----- Comma operator
+    .loc 1 346 38
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-2276], edi
+    lea rax, [rbp-2272]
+    push rax
+    .loc 1 346 43
+    mov rdi, 6
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+    .loc 1 346 46
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2276]
+    push rax
+    .loc 1 346 53
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.136
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 347 12
+    push 6
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 347 23
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2268], edi
+#----- Expression statement
+    .loc 1 347 32
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2264], edi
+#----- Expression statement
+#----- Comma operator
+    .loc 1 347 38
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-2268], edi
+    lea rax, [rbp-2264]
+    push rax
+    .loc 1 347 43
+    mov rdi, 6
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+    .loc 1 347 46
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2264]
+    push rax
+    .loc 1 347 53
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.137
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 349 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 349 26
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2260], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 349 39
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2256], edi
+    .loc 1 349 44
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2260]
+    push rax
+    .loc 1 349 51
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.138
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 350 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 350 26
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2252], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 350 39
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2248], edi
+#----- Expression statement
+    .loc 1 350 52
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-2244], edi
+    .loc 1 350 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2252]
+    push rax
+    .loc 1 350 62
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.139
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 351 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 351 26
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2240], edi
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 351 35
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2240], edi
+    .loc 1 351 40
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2240]
+    push rax
+    .loc 1 351 47
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.140
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 353 12
+    push 2
+#----- Block {...} or Statement expression
+    .loc 1 353 24
+    push 2
+    .loc 1 353 31
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.141
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 354 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Block {...} or Statement expression
+    .loc 1 354 29
+    push 2
+    .loc 1 354 36
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.142
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 355 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+#----- Block {...} or Statement expression
+    .loc 1 355 23
+    push 1
+    .loc 1 355 25
+    mov rdi, 1
+    pop rax
+    sub rax, rdi
+    .loc 1 355 31
+    push 2
+    .loc 1 355 38
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.143
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 356 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 356 24
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2236], edi
+    .loc 1 356 27
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2236]
+    push rax
+    .loc 1 356 34
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.144
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 357 12
+    push 1
+#----- Block {...} or Statement expression
+    .loc 1 357 17
+    push 1
+    .loc 1 357 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.145
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 358 12
+    push 6
+#----- Block {...} or Statement expression
+    .loc 1 358 17
+    push 1
+#----- Block {...} or Statement expression
+    .loc 1 358 26
+    mov rdi, 2
+    pop rax
+    add rax, rdi
+    push rax
+#----- Block {...} or Statement expression
+    .loc 1 358 35
+    mov rdi, 3
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 358 41
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.146
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 359 12
+    push 119
+#----- Block {...} or Statement expression
+    .loc 1 359 25
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.147]
+    push rax
+    .loc 1 359 33
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.148
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 361 12
+    push 0
+    .loc 1 361 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.149]
+    push rax
+    .loc 1 361 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.150
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 362 12
+    push 119
+    .loc 1 362 23
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.147]
+    push rax
+    .loc 1 362 28
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.151
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 363 12
+    push 127
+    .loc 1 363 23
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.152]
+    push rax
+    .loc 1 363 28
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.153
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 369 12
+    push 0
+    .loc 1 369 19
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.149]
+    push rax
+    .loc 1 369 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.154
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 370 12
+    push 16
+    .loc 1 370 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.155]
+    push rax
+    .loc 1 370 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.156
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 371 12
+    push 65
+    .loc 1 371 22
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.157]
+    push rax
+    .loc 1 371 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.158
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 372 12
+    push 104
+    .loc 1 372 24
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.159]
+    push rax
+    .loc 1 372 29
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.160
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 374 12
+    push 7
+    .loc 1 374 23
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.161]
+    push rax
+    .loc 1 374 28
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.162
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 375 12
+    push 120
+    .loc 1 375 25
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.161+1]
+    push rax
+    .loc 1 375 30
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.163
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 376 12
+    push 10
+    .loc 1 376 24
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.161+2]
+    push rax
+    .loc 1 376 29
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.164
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 377 12
+    push 121
+    .loc 1 377 25
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.161+3]
+    push rax
+    .loc 1 377 30
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.165
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 379 12
+    push 7
+    .loc 1 379 19
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.166]
+    push rax
+    .loc 1 379 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.167
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 380 12
+    push 8
+    .loc 1 380 19
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.168]
+    push rax
+    .loc 1 380 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.169
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 381 12
+    push 9
+    .loc 1 381 19
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.170]
+    push rax
+    .loc 1 381 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.171
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 382 12
+    push 10
+    .loc 1 382 20
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.172]
+    push rax
+    .loc 1 382 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.173
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 383 12
+    push 11
+    .loc 1 383 20
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.174]
+    push rax
+    .loc 1 383 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.175
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 384 12
+    push 12
+    .loc 1 384 20
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.176]
+    push rax
+    .loc 1 384 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.177
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 385 12
+    push 13
+    .loc 1 385 20
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.178]
+    push rax
+    .loc 1 385 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.179
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 386 12
+    push 27
+    .loc 1 386 20
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.180]
+    push rax
+    .loc 1 386 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.181
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 387 12
+    push 0
+    .loc 1 387 19
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.149]
+    push rax
+    .loc 1 387 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.154
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 389 12
+    push 106
+    .loc 1 389 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.182]
+    push rax
+    .loc 1 389 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.183
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 390 12
+    push 107
+    .loc 1 390 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.184]
+    push rax
+    .loc 1 390 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.185
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 391 12
+    push 108
+    .loc 1 391 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.186]
+    push rax
+    .loc 1 391 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.187
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 393 12
+    push 92
+    .loc 1 393 16
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call queenssol8
+    add rsp, 8
+    push rax
+    .loc 1 393 30
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.188
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 394 12
+    push 97
+    .loc 1 394 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.189]
+    push rax
+    .loc 1 394 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.190
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 395 12
+    push 98
+    .loc 1 395 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.189+1]
+    push rax
+    .loc 1 395 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.191
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 396 12
+    push 99
+    .loc 1 396 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.189+2]
+    push rax
+    .loc 1 396 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.192
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 397 12
+    push 0
+    .loc 1 397 21
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rip+.L.data.189+3]
+    push rax
+    .loc 1 397 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.193
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 398 12
+    push 102
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 398 30
+#----- Global variable
+    mov rdi, offset .L.data.194
+#----- Store a value to the memory address.
+    mov [rbp-2232], rdi
+#----- Expression statement
+    .loc 1 398 47
+#----- Global variable
+    mov rdi, offset .L.data.195
+#----- Store a value to the memory address.
+    mov [rbp-2224], rdi
+#----- Load a value from the memory address.
+    .loc 1 398 54
+#----- Load a value from the memory address.
+    mov rax, [rbp-2232]
+    movsx rax, byte ptr [rax]
+    push rax
+    .loc 1 398 64
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.196
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 399 12
+    push 4
+    .loc 1 399 15
+    push 4
+    .loc 1 399 30
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.197
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 400 12
+    push 97
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 400 34
+#----- Global variable
+    mov rdi, offset .L.data.198
+#----- Store a value to the memory address.
+    mov [rbp-2216], rdi
+#----- Expression statement
+    .loc 1 400 49
+#----- Global variable
+    mov rdi, offset .L.data.199
+#----- Store a value to the memory address.
+    mov [rbp-2208], rdi
+#----- Load a value from the memory address.
+    .loc 1 400 56
+#----- Load a value from the memory address.
+    mov rax, [rbp-2216]
+    movsx rax, byte ptr [rax]
+    push rax
+    .loc 1 400 66
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.200
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 401 12
+    push 3
+#----- Block {...} or Statement expression
+    .loc 1 401 29
+    push 3
+    .loc 1 401 44
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.201
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 402 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 402 27
+    push 8
+    .loc 1 402 42
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.202
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 404 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 404 25
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2177], dil
+    .loc 1 404 28
+#----- Load a value from the memory address.
+    movsx rax, byte ptr [rbp-2177]
+    push rax
+    .loc 1 404 35
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.203
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 406 12
+    push 3
+    .loc 1 406 15
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rip+g1]
+    push rax
+    .loc 1 406 19
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.85
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+    .loc 1 408 13
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rip+g2], edi
+#----- Expression statement
+    .loc 1 408 24
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rip+g2+4], edi
+#----- Expression statement
+    .loc 1 408 35
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rip+g2+8], edi
+#----- Expression statement
+    .loc 1 408 46
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rip+g2+12], edi
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 409 12
+    push 0
+    .loc 1 409 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rip+g2]
+    push rax
+    .loc 1 409 22
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.204
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 410 12
+    push 1
+    .loc 1 410 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rip+g2+4]
+    push rax
+    .loc 1 410 22
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.205
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 411 12
+    push 2
+    .loc 1 411 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rip+g2+8]
+    push rax
+    .loc 1 411 22
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.206
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 412 12
+    push 3
+    .loc 1 412 17
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rip+g2+12]
+    push rax
+    .loc 1 412 22
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.76
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 414 12
+    push 4
+    .loc 1 414 15
+    push 4
+    .loc 1 414 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.207
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 415 12
+    push 16
+    .loc 1 415 16
+    push 16
+    .loc 1 415 28
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.208
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 417 12
+    push 0
+#----- Block {...} or Statement expression
+    .loc 1 417 24
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2176]
+    push rax
+    .loc 1 417 31
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.209
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 418 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 418 37
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-2172], edi
+#----- Expression statement
+    .loc 1 418 47
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2168], edi
+#----- Expression statement
+    .loc 1 418 57
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2164], edi
+#----- Expression statement
+    .loc 1 418 67
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2160], edi
+    .loc 1 418 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2172]
+    push rax
+    .loc 1 418 82
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.210
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 419 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 419 37
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-2156], edi
+#----- Expression statement
+    .loc 1 419 47
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2152], edi
+#----- Expression statement
+    .loc 1 419 57
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2148], edi
+#----- Expression statement
+    .loc 1 419 67
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2144], edi
+    .loc 1 419 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2152]
+    push rax
+    .loc 1 419 82
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.211
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 420 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 420 37
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-2140], edi
+#----- Expression statement
+    .loc 1 420 47
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2136], edi
+#----- Expression statement
+    .loc 1 420 57
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2132], edi
+#----- Expression statement
+    .loc 1 420 67
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2128], edi
+    .loc 1 420 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2132]
+    push rax
+    .loc 1 420 82
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.212
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 421 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 421 37
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-2124], edi
+#----- Expression statement
+    .loc 1 421 47
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-2120], edi
+#----- Expression statement
+    .loc 1 421 57
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-2116], edi
+#----- Expression statement
+    .loc 1 421 67
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-2112], edi
+    .loc 1 421 73
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-2112]
+    push rax
+    .loc 1 421 82
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.213
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 423 12
+    push 4
+#----- Block {...} or Statement expression
+    .loc 1 423 26
+    push 4
+    .loc 1 423 41
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.214
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 424 12
+    push 16
+#----- Block {...} or Statement expression
+    .loc 1 424 30
+    push 16
+    .loc 1 424 45
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.215
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 427 12
+    push 4
+#----- Block {...} or Statement expression
+    .loc 1 427 25
+    push 4
+    .loc 1 427 40
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.216
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 428 12
+    push 4
+#----- Block {...} or Statement expression
+    .loc 1 428 25
+    push 4
+    .loc 1 428 39
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.217
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 429 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 429 26
+    push 8
+    .loc 1 429 41
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.218
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 430 12
+    push 16
+#----- Block {...} or Statement expression
+    .loc 1 430 29
+    push 16
+    .loc 1 430 44
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.219
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 431 12
+    push 48
+#----- Block {...} or Statement expression
+    .loc 1 431 32
+    push 48
+    .loc 1 431 47
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.220
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 432 12
+    push 16
+#----- Block {...} or Statement expression
+    .loc 1 432 32
+    push 16
+    .loc 1 432 48
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.221
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 433 12
+    push 4
+#----- Block {...} or Statement expression
+    .loc 1 433 31
+    push 4
+    .loc 1 433 48
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.222
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 434 12
+    push 5
+#----- Block {...} or Statement expression
+    .loc 1 434 31
+    push 4
+    .loc 1 434 45
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 434 52
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.223
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 435 12
+    push 5
+#----- Block {...} or Statement expression
+    .loc 1 435 31
+    push 4
+    .loc 1 435 44
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 435 51
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.224
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 436 12
+    push 8
+#----- Block {...} or Statement expression
+    .loc 1 436 31
+    push 8
+    .loc 1 436 52
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.225
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 438 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 438 40
+    lea rax, [rbp-1768]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1744], rdi
+#----- Expression statement
+    .loc 1 438 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-1744]
+    push rax
+    .loc 1 438 50
+    xor edi, edi
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+    .loc 1 438 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1768]
+    push rax
+    .loc 1 438 66
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.226
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 439 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 439 40
+    lea rax, [rbp-1736]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1712], rdi
+#----- Expression statement
+    .loc 1 439 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-1712]
+    push rax
+    .loc 1 439 50
+    mov rdi, 1
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+4], edi
+    .loc 1 439 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1732]
+    push rax
+    .loc 1 439 66
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.227
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 440 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 440 40
+    lea rax, [rbp-1704]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1680], rdi
+#----- Expression statement
+    .loc 1 440 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-1680]
+    push rax
+    .loc 1 440 50
+    mov rdi, 2
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+8], edi
+    .loc 1 440 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1696]
+    push rax
+    .loc 1 440 67
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.228
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 441 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 441 40
+    lea rax, [rbp-1672]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1648], rdi
+#----- Expression statement
+    .loc 1 441 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-1648]
+    push rax
+    .loc 1 441 50
+    mov rdi, 3
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+12], edi
+    .loc 1 441 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1660]
+    push rax
+    .loc 1 441 67
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.229
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 442 12
+    push 4
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 442 40
+    lea rax, [rbp-1640]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1616], rdi
+#----- Expression statement
+    .loc 1 442 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-1616]
+    push rax
+    .loc 1 442 50
+    mov rdi, 4
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+16], edi
+    .loc 1 442 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1624]
+    push rax
+    .loc 1 442 67
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.230
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 443 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 443 40
+    lea rax, [rbp-1608]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1584], rdi
+#----- Expression statement
+    .loc 1 443 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-1584]
+    push rax
+    .loc 1 443 50
+    mov rdi, 5
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+20], edi
+    .loc 1 443 57
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1588]
+    push rax
+    .loc 1 443 66
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.231
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 445 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 445 40
+    lea rax, [rbp-1576]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1552], rdi
+#----- Expression statement
+    .loc 1 445 44
+#----- Load a value from the memory address.
+    mov rax, [rbp-1552]
+    push rax
+    .loc 1 445 48
+    xor edi, edi
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+    .loc 1 445 51
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1576]
+    push rax
+    .loc 1 445 60
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.232
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 446 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 446 40
+    lea rax, [rbp-1544]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1520], rdi
+#----- Expression statement
+    .loc 1 446 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1520]
+    push rax
+    .loc 1 446 52
+    mov rdi, 1
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+4], edi
+    .loc 1 446 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1540]
+    push rax
+    .loc 1 446 72
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.233
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 447 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 447 40
+    lea rax, [rbp-1512]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1488], rdi
+#----- Expression statement
+    .loc 1 447 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1488]
+    push rax
+    .loc 1 447 52
+    mov rdi, 2
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+8], edi
+    .loc 1 447 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1504]
+    push rax
+    .loc 1 447 72
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.234
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 448 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 448 40
+    lea rax, [rbp-1480]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1456], rdi
+#----- Expression statement
+    .loc 1 448 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1456]
+    push rax
+    .loc 1 448 52
+    mov rdi, 3
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+12], edi
+    .loc 1 448 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1468]
+    push rax
+    .loc 1 448 68
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.235
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 449 12
+    push 4
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 449 40
+    lea rax, [rbp-1448]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1424], rdi
+#----- Expression statement
+    .loc 1 449 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1424]
+    push rax
+    .loc 1 449 52
+    mov rdi, 4
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+16], edi
+    .loc 1 449 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1432]
+    push rax
+    .loc 1 449 72
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.236
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 450 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 450 40
+    lea rax, [rbp-1416]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1392], rdi
+#----- Expression statement
+    .loc 1 450 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1392]
+    push rax
+    .loc 1 450 52
+    mov rdi, 5
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax+20], edi
+    .loc 1 450 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1396]
+    push rax
+    .loc 1 450 72
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.237
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 452 12
+    push 1
+#----- Block {...} or Statement expression
+    .loc 1 452 31
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1372]
+    push rax
+    .loc 1 452 42
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1372]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 452 59
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.238
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 453 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 453 40
+    lea rax, [rbp-1360]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1336], rdi
+#----- Load a value from the memory address.
+    .loc 1 453 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1336]
+    movsxd rax, dword ptr [rax+12]
+    push rax
+    .loc 1 453 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1348]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 453 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.239
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 454 12
+    push 1
+#----- Block {...} or Statement expression
+    .loc 1 454 31
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1304]
+    push rax
+    .loc 1 454 46
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1304]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 454 59
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.240
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 455 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 455 40
+    lea rax, [rbp-1304]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1280], rdi
+#----- Load a value from the memory address.
+    .loc 1 455 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1280]
+    movsxd rax, dword ptr [rax+24]
+    push rax
+    .loc 1 455 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1280]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 455 66
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.241
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 456 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 456 40
+    lea rax, [rbp-1272]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1248], rdi
+#----- Load a value from the memory address.
+    .loc 1 456 45
+#----- Load a value from the memory address.
+    mov rax, [rbp-1248]
+    movsxd rax, dword ptr [rax+24]
+    push rax
+    .loc 1 456 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1248]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 456 70
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.242
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 458 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 458 37
+    lea rax, [rbp-1240]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1232], rdi
+#----- Expression statement
+    .loc 1 458 41
+#----- Load a value from the memory address.
+    mov rax, [rbp-1232]
+    push rax
+    .loc 1 458 45
+    mov rdi, 3
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+    .loc 1 458 48
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1240]
+    push rax
+    .loc 1 458 56
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.243
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 459 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 459 33
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1224], edi
+#----- Expression statement
+    .loc 1 459 45
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-1220], edi
+#----- Expression statement
+    .loc 1 459 57
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1216], edi
+    .loc 1 459 60
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1224]
+    push rax
+    .loc 1 459 68
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.244
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 460 12
+    push 4
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 460 33
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1212], edi
+#----- Expression statement
+    .loc 1 460 45
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-1208], edi
+#----- Expression statement
+    .loc 1 460 57
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1204], edi
+    .loc 1 460 60
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1208]
+    push rax
+    .loc 1 460 72
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.245
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 461 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 461 33
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1200], edi
+#----- Expression statement
+    .loc 1 461 45
+    mov rdi, 4
+#----- Store a value to the memory address.
+    mov [rbp-1196], edi
+#----- Expression statement
+    .loc 1 461 57
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1192], edi
+    .loc 1 461 60
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1192]
+    push rax
+    .loc 1 461 72
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.246
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 462 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 462 37
+    lea rax, [rbp-1188]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1176], rdi
+#----- Load a value from the memory address.
+    .loc 1 462 42
+#----- Load a value from the memory address.
+    mov rax, [rbp-1176]
+    movsxd rax, dword ptr [rax+8]
+    push rax
+    .loc 1 462 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1180]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 462 62
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.247
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 464 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 464 28
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1168], edi
+    .loc 1 464 31
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1168]
+    push rax
+    .loc 1 464 42
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.248
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 465 12
+    push 8
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 465 28
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1164], edi
+#----- Expression statement
+    .loc 1 465 41
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1160], edi
+    .loc 1 465 45
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1164]
+    push rax
+    .loc 1 465 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1160]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 465 65
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.249
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 466 12
+    push 0
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 466 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1156], edi
+#----- Expression statement
+    .loc 1 466 37
+    lea rax, [rbp-1156]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1152], edi
+    .loc 1 466 41
+    lea rax, [rbp-1156]
+    push rax
+    .loc 1 466 44
+    mov rdi, 1
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    push rax
+    .loc 1 466 49
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1152]
+    push rax
+    .loc 1 466 51
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 466 58
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.250
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 467 12
+    push 1
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 467 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1148], edi
+#----- Expression statement
+    .loc 1 467 37
+    lea rax, [rbp-1148]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1144], edi
+    .loc 1 467 41
+    lea rax, [rbp-1148]
+    push rax
+    .loc 1 467 44
+    mov rdi, 1
+    pop rax
+    imul rdi, 4
+    add rax, rdi
+    push rax
+    .loc 1 467 49
+    lea rax, [rbp-1144]
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 467 58
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.251
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 470 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 470 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1140], edi
+#----- Expression statement
+    .loc 1 470 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1136], edi
+#----- Expression statement
+    .loc 1 470 50
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-1140], edi
+    .loc 1 470 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1140]
+    push rax
+    .loc 1 470 60
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.252
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 471 12
+    push 8
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 471 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1132], edi
+#----- Expression statement
+    .loc 1 471 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1128], edi
+#----- Function call with up to 6 parameters. 
+    .loc 1 471 44
+    lea rax, [rbp-1132]
+    push rax
+    .loc 1 471 48
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1128]
+#-- 引数をレジスタにセット 
+    mov rsi, rax
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call foo
+    add rsp, 8
+    push rax
+    .loc 1 471 56
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.253
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 474 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 474 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1124], edi
+#----- Expression statement
+    .loc 1 474 38
+    lea rax, [rbp-1124]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1120], rdi
+#----- Expression statement
+    .loc 1 474 52
+    lea rax, [rbp-1120]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1112], rdi
+#----- Load a value from the memory address.
+#----- Load a value from the memory address.
+    .loc 1 474 58
+#----- Load a value from the memory address.
+    mov rax, [rbp-1112]
+    mov rax, [rax]
+    movsxd rax, dword ptr [rax]
+    push rax
+    .loc 1 474 65
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.254
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 476 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 476 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1100], edi
+#----- Expression statement
+    .loc 1 476 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1096], edi
+    .loc 1 476 40
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1096]
+    push rax
+    .loc 1 476 55
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.255
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 477 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 477 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1092], edi
+#----- Expression statement
+    .loc 1 477 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1088], edi
+    .loc 1 477 40
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1092]
+    push rax
+    .loc 1 477 55
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.256
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 478 12
+    push 22
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 478 27
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1084], edi
+#----- Expression statement
+    .loc 1 478 38
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1080], edi
+#----- Expression statement
+    .loc 1 478 49
+    mov rdi, 22
+#----- Store a value to the memory address.
+    mov [rbp-1076], edi
+    .loc 1 478 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1076]
+    push rax
+    .loc 1 478 68
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.257
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 479 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 479 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1072], edi
+#----- Expression statement
+    .loc 1 479 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1068], edi
+#----- Expression statement
+    .loc 1 479 48
+    mov rdi, 22
+#----- Store a value to the memory address.
+    mov [rbp-1064], edi
+    .loc 1 479 52
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1072]
+    push rax
+    .loc 1 479 67
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.258
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 480 12
+    push 5
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 480 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1060], edi
+#----- Expression statement
+    .loc 1 480 38
+    lea rax, [rbp-1060]
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1056], rdi
+#----- Expression statement
+    .loc 1 480 43
+#----- Load a value from the memory address.
+    mov rax, [rbp-1056]
+    push rax
+    .loc 1 480 47
+    mov rdi, 5
+    pop rax
+#----- Store a value to the memory address.
+    mov [rax], edi
+    .loc 1 480 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1060]
+    push rax
+    .loc 1 480 57
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.259
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 481 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 481 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1048], edi
+#----- Expression statement
+    .loc 1 481 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1044], edi
+#----- Expression statement
+    .loc 1 481 50
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-1044], edi
+    .loc 1 481 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1044]
+    push rax
+    .loc 1 481 60
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.260
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 482 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 482 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1040], edi
+#----- Expression statement
+    .loc 1 482 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-1036], edi
+#----- Expression statement
+    .loc 1 482 50
+    mov rdi, 7
+#----- Store a value to the memory address.
+    mov [rbp-1040], edi
+    .loc 1 482 53
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1040]
+    push rax
+    .loc 1 482 60
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.252
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 484 12
+    push 3
+#----- Function call with up to 6 parameters. 
+    .loc 1 484 20
+    push 1
+    .loc 1 484 23
+#-- 引数をレジスタにセット 
+    mov rsi, 2
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call add2
+    add rsp, 8
+    push rax
+    .loc 1 484 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.261
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 485 12
+    push 1
+#----- Function call with up to 6 parameters. 
+    .loc 1 485 20
+    push 4
+    .loc 1 485 23
+#-- 引数をレジスタにセット 
+    mov rsi, 3
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call sub2
+    add rsp, 8
+    push rax
+    .loc 1 485 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.262
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 486 12
+    push 7
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 486 26
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-1032], edi
+#----- Expression statement
+    .loc 1 486 37
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-1028], edi
+#----- Expression statement
+    .loc 1 486 48
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-1024], edi
+    .loc 1 486 51
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1032]
+    push rax
+    .loc 1 486 55
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1028]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 486 59
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1024]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+#----- Function call with up to 6 parameters. 
+    .loc 1 486 68
+    push 4
+    .loc 1 486 71
+#-- 引数をレジスタにセット 
+    mov rsi, 3
+    pop rdi
+    xor eax, eax
+    call sub2
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 486 79
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.263
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 487 12
+    push 8
+#----- Function call with up to 6 parameters. 
+    .loc 1 487 19
+#-- 引数をレジスタにセット 
+    mov rdi, 5
+    sub rsp, 8
+    xor eax, eax
+    call fib
+    add rsp, 8
+    push rax
+    .loc 1 487 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.264
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 488 12
+    push 55
+#----- Function call with up to 6 parameters. 
+    .loc 1 488 20
+#-- 引数をレジスタにセット 
+    mov rdi, 9
+    sub rsp, 8
+    xor eax, eax
+    call fib
+    add rsp, 8
+    push rax
+    .loc 1 488 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.265
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 490 12
+    push 21
+#----- Function call with up to 6 parameters. 
+    .loc 1 490 21
+    push 1
+    .loc 1 490 23
+    push 2
+    .loc 1 490 25
+    push 3
+    .loc 1 490 27
+    push 4
+    .loc 1 490 29
+    push 5
+    .loc 1 490 31
+#-- 引数をレジスタにセット 
+    mov r9, 6
+    pop r8
+    pop rcx
+    pop rdx
+    pop rsi
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call add6
+    add rsp, 8
+    push rax
+    .loc 1 490 35
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.266
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 491 12
+    push 8
+#----- Function call with up to 6 parameters. 
+    .loc 1 491 20
+    push 3
+    .loc 1 491 23
+#-- 引数をレジスタにセット 
+    mov rsi, 5
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call add2
+    add rsp, 8
+    push rax
+    .loc 1 491 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.267
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 492 12
+    push 2
+#----- Function call with up to 6 parameters. 
+    .loc 1 492 20
+    push 5
+    .loc 1 492 23
+#-- 引数をレジスタにセット 
+    mov rsi, 3
+    pop rdi
+    sub rsp, 8
+    xor eax, eax
+    call sub2
+    add rsp, 8
+    push rax
+    .loc 1 492 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.268
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 494 12
+    push 3
+    .loc 1 494 15
+#----- Function call with up to 6 parameters. 
+#-- 引数をレジスタにセット 
+    sub rsp, 8
+    xor eax, eax
+    call ret3
+    add rsp, 8
+    push rax
+    .loc 1 494 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.269
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 495 12
+    push 5
+#----- Inlined call to ret5
+    .loc 1 32 12
+#----- Returns to the caller address.
+    mov rax, 5
+.L.inline.end.178:
+    push rax
+    .loc 1 495 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.270
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 497 12
+    push 3
+#----- Block {...} or Statement expression
+    .loc 1 497 26
+    push 3
+    .loc 1 497 33
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.271
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 498 12
+    push 0
+#----- Block {...} or Statement expression
+    .loc 1 498 18
+    push 0
+    .loc 1 498 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.272
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 507 12
+    push 55
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 507 25
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-1020], edi
+#----- Expression statement
+    .loc 1 507 34
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-1016], edi
+    .loc 1 507 37
+#----- "While" statement
+    cmp dword ptr [rbp-1020], 10
+    jg .L.end.179
+    .p2align 4,,10
+.L.begin.179:
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 507 56
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1020]
+    push rax
+    .loc 1 507 58
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1016]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-1016], edi
+#----- Expression statement
+    .loc 1 507 62
+#----- Read-modify-write
+    add dword ptr [rbp-1020], 1
+    movsxd rax, dword ptr [rbp-1020]
+    cmp dword ptr [rbp-1020], 10
+    jle .L.begin.179
+.L.end.179:
+    .loc 1 507 69
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1016]
+    push rax
+    .loc 1 507 76
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.273
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 508 12
+    push 58
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 508 25
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-1012], edi
+#----- Expression statement
+    .loc 1 508 34
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-1008], edi
+    .loc 1 508 51
+#----- "For" statement
+    cmp dword ptr [rbp-1012], 10
+    jg .L.end.180
+    .p2align 4,,10
+.L.begin.180:
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 508 79
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-1004], edi
+#----- Expression statement
+    .loc 1 508 86
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-1000], edi
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 508 93
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1012]
+    mov rdi, rax
+    add [rbp-1008], edi
+    movsxd rax, dword ptr [rbp-1008]
+#----- Expression statement
+    .loc 1 508 67
+#----- Read-modify-write
+    add dword ptr [rbp-1012], 1
+    movsxd rax, dword ptr [rbp-1012]
+    cmp dword ptr [rbp-1012], 10
+    jle .L.begin.180
+.L.end.180:
+    .loc 1 508 98
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1008]
+    push rax
+    .loc 1 508 100
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1004]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 508 102
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-1000]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 508 109
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.274
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 510 12
+    push 55
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 510 25
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-996], edi
+#----- Expression statement
+    .loc 1 510 34
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-992], edi
+    .loc 1 510 37
+#----- "For" statement
+    cmp dword ptr [rbp-996], 10
+    jg .L.end.181
+    .p2align 4,,10
+.L.begin.181:
+#----- Expression statement
+#----- Read-modify-write
+    .loc 1 510 63
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-996]
+    mov rdi, rax
+    add [rbp-992], edi
+    movsxd rax, dword ptr [rbp-992]
+#----- Expression statement
+    .loc 1 510 53
+#----- Read-modify-write
+    add dword ptr [rbp-996], 1
+    movsxd rax, dword ptr [rbp-996]
+    cmp dword ptr [rbp-996], 10
+    jle .L.begin.181
+.L.end.181:
+    .loc 1 510 66
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-992]
+    push rax
+    .loc 1 510 73
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.275
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 512 12
+    push 10
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 512 27
+    xor edi, edi
+#----- Store a value to the memory address.
+    mov [rbp-988], edi
+    .loc 1 512 30
+#----- "While" statement
+    cmp dword ptr [rbp-988], 10
+    jge .L.end.182
+    .p2align 4,,10
+.L.begin.182:
+#----- Expression statement
+    .loc 1 512 45
+#----- Read-modify-write
+    add dword ptr [rbp-988], 1
+    movsxd rax, dword ptr [rbp-988]
+    cmp dword ptr [rbp-988], 10
+    jl .L.begin.182
+.L.end.182:
+    .loc 1 512 51
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-988]
+    push rax
+    .loc 1 512 58
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.276
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 514 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 514 47
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-984], edi
+    .loc 1 514 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-984]
+    push rax
+    .loc 1 514 57
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.277
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 515 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 515 49
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-980], edi
+    .loc 1 515 52
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-980]
+    push rax
+    .loc 1 515 59
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.278
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 516 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 516 35
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-976], edi
+    .loc 1 516 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-976]
+    push rax
+    .loc 1 516 57
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.279
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 517 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 517 37
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-972], edi
+    .loc 1 517 52
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-972]
+    push rax
+    .loc 1 517 59
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.280
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 519 12
+    push 3
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 519 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-968], edi
+    .loc 1 519 29
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-968]
+    push rax
+    .loc 1 519 38
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.281
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 520 12
+    push 8
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 520 29
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-964], edi
+#----- Expression statement
+    .loc 1 520 40
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-960], edi
+    .loc 1 520 43
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-964]
+    push rax
+    .loc 1 520 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-960]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 520 59
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.282
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 521 12
+    push 6
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 521 28
+    mov rdi, 1
+#----- Store a value to the memory address.
+    mov [rbp-956], edi
+#----- Expression statement
+    .loc 1 521 41
+    push 2
+    .loc 1 521 45
+    mov rdi, 3
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-952], edi
+    .loc 1 521 48
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-956]
+    push rax
+    .loc 1 521 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-952]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 521 63
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.283
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 522 12
+    push 12
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 522 27
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-948], edi
+#----- Expression statement
+    .loc 1 522 38
+    push 5
+    .loc 1 522 42
+    mov rdi, 6
+    pop rax
+    imul rax, rdi
+    push rax
+    .loc 1 522 46
+    mov rdi, 8
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-944], edi
+    .loc 1 522 50
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-948]
+    push rax
+    .loc 1 522 54
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-944]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 522 59
+    mov rdi, 2
+    pop rax
+    cqo
+    idiv rax, rdi
+    push rax
+    .loc 1 522 66
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.284
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 524 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 524 24
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-940], edi
+    .loc 1 524 27
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-940]
+    push rax
+    .loc 1 524 34
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.285
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 525 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 525 24
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-936], edi
+#----- Expression statement
+    .loc 1 525 33
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-932], edi
+    .loc 1 525 36
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-936]
+    push rax
+    .loc 1 525 43
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.286
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 526 12
+    push 2
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 526 26
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-928], edi
+#----- Expression statement
+    .loc 1 526 37
+    mov rdi, 2
+#----- Store a value to the memory address.
+    mov [rbp-924], edi
+    .loc 1 526 40
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-924]
+    push rax
+    .loc 1 526 47
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.287
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 527 12
+    push 8
+#----- Block {...} or Statement expression
+#----- Expression statement
+    .loc 1 527 26
+    mov rdi, 3
+#----- Store a value to the memory address.
+    mov [rbp-920], edi
+#----- Expression statement
+    .loc 1 527 37
+    mov rdi, 5
+#----- Store a value to the memory address.
+    mov [rbp-916], edi
+    .loc 1 527 40
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-920]
+    push rax
+    .loc 1 527 44
+#----- Load a value from the memory address.
+    movsxd rax, dword ptr [rbp-916]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 527 51
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.288
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 529 12
+    push 3
+#----- Block {...} or Statement expression
+    .loc 1 529 18
+    push 3
+    .loc 1 529 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.289
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 530 12
+    push 5
+#----- Block {...} or Statement expression
+    .loc 1 530 18
+    push 5
+    .loc 1 530 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.290
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 531 12
+    push 3
+#----- Block {...} or Statement expression
+    .loc 1 531 23
+    push 3
+    .loc 1 531 29
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.291
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 539 12
+    push 1
+    .loc 1 539 15
+    xor eax, eax
+    cmp rax, 1
+    setne al
+    movzb rax, al
+    push rax
+    .loc 1 539 22
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.292
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 540 12
+    push 0
+    .loc 1 540 15
+    mov rax, 42
+    cmp rax, 42
+    setne al
+    movzb rax, al
+    push rax
+    .loc 1 540 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.293
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 541 12
+    push 0
+    .loc 1 541 16
+    push 8
+    .loc 1 541 19
+    push 3
+    .loc 1 541 21
+    mov rdi, 5
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 541 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.294
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 542 12
+    push 1
+    .loc 1 542 16
+    mov rax, 8
+    cmp rax, 8
+    sete al
+    movzb rax, al
+    push rax
+    .loc 1 542 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.295
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 543 12
+    push 0
+    .loc 1 543 16
+    mov rax, 8
+    cmp rax, 8
+    setne al
+    movzb rax, al
+    push rax
+    .loc 1 543 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.296
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 544 12
+    push 1
+    .loc 1 544 19
+    push 0
+    .loc 1 544 20
+    mov rdi, 8
+    pop rax
+    sub rax, rdi
+    cmp rax, 8
+    setne al
+    movzb rax, al
+    push rax
+    .loc 1 544 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.297
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 545 12
+    push 0
+    .loc 1 545 16
+    mov rax, 200
+    cmp rax, 200
+    setl al
+    movzb rax, al
+    push rax
+    .loc 1 545 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.298
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 546 12
+    push 1
+    .loc 1 546 16
+    mov rax, 200
+    cmp rax, 200
+    setle al
+    movzb rax, al
+    push rax
+    .loc 1 546 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.299
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 547 12
+    push 1
+    .loc 1 547 16
+    mov rax, 200
+    cmp rax, 201
+    setl al
+    movzb rax, al
+    push rax
+    .loc 1 547 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.300
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 548 12
+    push 1
+    .loc 1 548 16
+    mov rax, 200
+    cmp rax, 201
+    setle al
+    movzb rax, al
+    push rax
+    .loc 1 548 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.301
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 549 12
+    push 1
+    .loc 1 549 21
+    mov rax, 200
+    cmp rax, 201
+    setl al
+    movzb rax, al
+    push rax
+    .loc 1 549 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.302
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 550 12
+    push 1
+    .loc 1 550 22
+    mov rax, 200
+    cmp rax, 201
+    setle al
+    movzb rax, al
+    push rax
+    .loc 1 550 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.303
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 551 12
+    push 0
+    .loc 1 551 16
+    mov rax, 201
+    cmp rax, 200
+    setl al
+    movzb rax, al
+    push rax
+    .loc 1 551 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.304
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 552 12
+    push 0
+    .loc 1 552 16
+    mov rax, 201
+    cmp rax, 200
+    setle al
+    movzb rax, al
+    push rax
+    .loc 1 552 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.305
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 554 12
+    push 10
+    .loc 1 554 16
+    push 0
+    .loc 1 554 18
+    push 0
+    .loc 1 554 19
+    mov rdi, 10
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+#----- Store a value to the memory address.
+    mov [rbp-8], rdi
+    push rdi
+    .loc 1 554 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.306
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 555 12
+    push 10
+    .loc 1 555 16
+#----- Load a value from the memory address.
+    mov rax, [rbp-8]
+    push rax
+    .loc 1 555 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.307
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 556 12
+    push 22
+    .loc 1 556 17
+    push 3
+    .loc 1 556 19
+    push 0
+    .loc 1 556 20
+    mov rdi, 5
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    push rax
+    .loc 1 556 22
+    mov rdi, 37
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 556 26
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.308
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 557 12
+    push 100
+    .loc 1 557 17
+    push 0
+    .loc 1 557 18
+    mov rdi, 100
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 557 22
+    mov rdi, 200
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 557 27
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.309
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 558 12
+    push 4
+    .loc 1 558 16
+    push 3
+    .loc 1 558 18
+    mov rdi, 5
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 558 21
+    mov rdi, 2
+    pop rax
+    cqo
+    idiv rax, rdi
+    push rax
+    .loc 1 558 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.310
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 559 12
+    push 15
+    .loc 1 559 16
+    push 5
+    .loc 1 559 19
+    push 9
+    .loc 1 559 21
+    mov rdi, 6
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    push rax
+    .loc 1 559 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.311
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 560 12
+    push 47
+    .loc 1 560 16
+    push 5
+    .loc 1 560 18
+    push 6
+    .loc 1 560 20
+    mov rdi, 7
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 560 23
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.312
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 561 12
+    push 26
+    .loc 1 561 16
+    push 2
+    .loc 1 561 18
+    mov rdi, 3
+    pop rax
+    imul rax, rdi
+    push rax
+    .loc 1 561 20
+    push 4
+    .loc 1 561 22
+    mov rdi, 5
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 561 25
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.313
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 562 12
+    push 41
+    .loc 1 562 16
+    push 12
+    .loc 1 562 21
+    mov rdi, 34
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 562 26
+    mov rdi, 5
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 562 30
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.314
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 563 12
+    push 21
+    .loc 1 563 16
+    push 5
+    .loc 1 563 18
+    mov rdi, 20
+    pop rax
+    add rax, rdi
+    push rax
+    .loc 1 563 21
+    mov rdi, 4
+    pop rax
+    sub rax, rdi
+    push rax
+    .loc 1 563 24
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.315
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 564 12
+    push 0
+    .loc 1 564 15
+    push 0
+    .loc 1 564 18
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.316
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 565 12
+    push 15
+    .loc 1 565 16
+    push 15
+    .loc 1 565 20
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdx, offset .L.data.317
+    pop rsi
+    pop rdi
+    xor eax, eax
+    call assert
+#----- Expression statement
+#----- Function call with up to 6 parameters. 
+    .loc 1 567 12
+#----- Global variable
+#-- 引数をレジスタにセット 
+    mov rdi, offset .L.data.318
+    xor eax, eax
+    call printf
+    .loc 1 568 12
+#----- Returns to the caller address.
+    mov rax, 0
+#----- Epilogue
+.L.return.main:
+    mov rsp, rbp
+    .cfi_def_cfa rsp, 16
+    pop rbp
+    .cfi_adjust_cfa_offset -8
+    .cfi_restore rbp
+    ret
+    .cfi_endproc
+.size main, .-main
+.section .note.GNU-stack,"",@progbits
@@ -73,6 +73,27 @@ void warn_tok(Token *tok, char *fmt, ...) {
     verror_at(tok->line_no, tok->str, fmt, ap);
 }
 
+// Reports an optimization note in the following format.
+//
+// foo.c:10: <message here>
+void info_tok(Token *tok, char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "%s:%d: ", current_filename, tok->line_no);
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    va_end(ap);
+}
+
+// Reports an optimization remark of `pass` in the following format.
+//
+// foo.c:10:5: remark: <message here> [-Rpass=inline]
+void remark_tok(Token *tok, char *flag, char *pass, char *fmt, va_list ap) {
+    fprintf(stderr, "%s:%d:%d: remark: ", current_filename, tok->line_no, tok->col_no);
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, " [%s=%s]\n", flag, pass);
+}
+
 // parseの中で呼び出すことでtokenがnodeに変換される
 // トークンはconsume/expect/expect_number関数の呼び出しの中で副作用としてひとつずつ読み進めている
 // 次のトークンが期待している記号の時には、トークンを一つ読み進める
@@ -129,7 +150,7 @@ long expect_number(void) {
 char *expect_ident(void) {
     if(token->kind != TK_IDENT)
         error_tok(token, "expected an identifier");
-    char *s = strndup(token->str, token->len);
+    char *s = alloc_strndup(MEM_STRING, token->str, token->len);
     token = token->next;
     return s;
 }
@@ -140,7 +161,8 @@ bool at_eof(void) {
 
 //　新しいトークンを作成して、curにつなげる
 static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-    Token *tok = calloc(1, sizeof(Token));
+    Token *tok = alloc(MEM_TOKEN, sizeof(Token));
+    stats.tokens++;
     tok->kind = kind;
     tok->str = str;
     tok->len = len;
@@ -169,7 +191,7 @@ static char *is_keyword(char *p) {
     // Keywords
     static char *kw[] = {
         "return", "if", "else", "while", "for", "int", "char", "sizeof",
-        "struct", "union", "short", "long", "void"
+        "struct", "union", "short", "long", "void", "static", "inline"
     };
 
     for(int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
@@ -270,7 +292,7 @@ static Token *read_string_literal(Token *cur, char *start) {
     }
 
     // 文字列全体を含めるのに十分なバッファをallocateする
-    char *buf = calloc(1, end - p + 1); // 文字の長さ分 + 1(後で追加する'\0'の分)
+    char *buf = alloc(MEM_STRING, end - p + 1); // 文字の長さ分 + 1(後で追加する'\0'の分)
     int len = 0;     // 文字数をカウント
 
     while(*p != '"') {
@@ -296,16 +318,19 @@ static Token *read_string_literal(Token *cur, char *start) {
 
 static void add_line_numbers(Token *tok) {
     char *p = current_input;
+    char *line = p;
     int n = 1;
 
     do {
         if (p == tok->str) {
             tok->line_no = n;
+            tok->col_no = p - line + 1;
             tok = tok->next;
         }
 
         if (*p == '\n') {
             n++;
+            line = p + 1;
         }
     } while(*p++);
 }
@@ -365,7 +390,8 @@ Token *tokenize(char *filename, char *p) {
         // 複数文字の方を先に書く
         if(startswith(p, "==") || startswith(p, "!=") ||
            startswith(p, "<=") || startswith(p, ">=") ||
-           startswith(p, "->")) {
+           startswith(p, "->") || startswith(p, "&&") ||
+           startswith(p, "||")) {
             cur = new_token(TK_RESERVED, cur, p, 2); // pの値を入力後pを2つ進める
             p += 2;
             continue;
@@ -8,7 +8,7 @@ Type *int_type = &(Type){TY_INT, 4, 4};
 Type *long_type = &(Type){TY_LONG, 8, 8};
 
 static Type *new_type(TypeKind kind, int size, int align) {
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = alloc(MEM_TYPE, sizeof(Type));
     ty->kind = kind;
     ty->size = size;
     ty->align = align;
@@ -69,29 +69,30 @@ Type *array_of(Type *base, int len) {
 }
 
 Type *func_type(Type *return_ty) {
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = alloc(MEM_TYPE, sizeof(Type));
     ty->kind = TY_FUNC;
     ty->return_ty = return_ty;
     return ty;
 }
 
 // nodeに型を付与する
-void add_type(Node *node) {
+static void visit(Node *node) {
+    stats.type_visits++;
     if( !node || node->ty )
         return;
     
-    add_type(node->lhs);
-    add_type(node->rhs);
-    add_type(node->cond);
-    add_type(node->then);
-    add_type(node->els);
-    add_type(node->init);
-    add_type(node->inc);
+    visit(node->lhs);
+    visit(node->rhs);
+    visit(node->cond);
+    visit(node->then);
+    visit(node->els);
+    visit(node->init);
+    visit(node->inc);
 
     for (Node *n = node->body; n; n = n->next)
-        add_type(n);
+        visit(n);
     for (Node *n = node->args; n; n = n->next)
-        add_type(n);
+        visit(n);
 
     switch(node->kind) {
     case ND_ADD:
@@ -103,6 +104,9 @@ void add_type(Node *node) {
     case ND_NE:
     case ND_LT:
     case ND_LE:
+    case ND_LOGAND:
+    case ND_LOGOR:
+    case ND_NOT:
     case ND_NUM:
     case ND_FUNCALL:
         node->ty = long_type;
@@ -145,3 +149,9 @@ void add_type(Node *node) {
     }
     }
 }
+
+void add_type(Node *node) {
+    timevar_push(TV_TYPE);
+    visit(node);
+    timevar_pop(TV_TYPE);
+}